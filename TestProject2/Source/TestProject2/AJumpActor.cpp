@@ -1,38 +1,42 @@
 #include "AJumpActor.h"
 #include "Components/StaticMeshComponent.h"
-#include "GameFramework/Character.h" // ACharacter ϱ  ߰
-#include "GameFramework/CharacterMovementComponent.h" // LaunchCharacter   
+#include "Engine/World.h"
+#include "JumpPadSubsystem.h"
+#include "NavLinkCustomComponent.h"
+#include "NavigationSystem.h"
+#include "PhysicsEngine/PhysicsSettings.h"
 
 // Sets default values
 AJumpActor::AJumpActor()
 {
-    // Set this actor to call Tick() every frame. You can turn this off to improve performance if you don't need it.
-    PrimaryActorTick.bCanEverTick = true;
+    //  ƽ  ( ó ߻ UJumpPadSubsystem  ϰ ó)
+    PrimaryActorTick.bCanEverTick = false;
 
     // ƽ ޽ Ʈ   Ʈ Ʈ 
     JumpPadMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("JumpPadMesh")); // BedMesh  JumpPadMesh 
     RootComponent = JumpPadMesh;
+    JumpPadMesh->SetGenerateOverlapEvents(false); //  Ʈ ڽ 
 
     // Ʈ ڽ   ޽ 
     TriggerBox = CreateDefaultSubobject<UBoxComponent>(TEXT("TriggerBox"));
     TriggerBox->SetupAttachment(JumpPadMesh); // BedMesh  JumpPadMesh 
     // ݸ 
     TriggerBox->SetBoxExtent(FVector(100.0f, 100.0f, 50.0f)); //  ũ 
-    TriggerBox->SetCollisionProfileName(TEXT("OverlapAllDynamic")); //   Ʈ ǵ 
-    // Ǵ Ư äο ° :
-    // TriggerBox->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
-    // TriggerBox->SetCollisionObjectType(ECC_WorldStatic); // Ǵ ٸ Object Type
-    // TriggerBox->SetCollisionResponseToAllChannels(ECR_Ignore);
-    // TriggerBox->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap); // Pawn 
-
-    //  ̺Ʈ ε
-    TriggerBox->OnComponentBeginOverlap.AddDynamic(this, &AJumpActor::OnOverlapBegin);
-    TriggerBox->OnComponentEndOverlap.AddDynamic(this, &AJumpActor::OnOverlapEnd);
+    //  JumpPad Ʈ ä, Pawn   (DefaultEngine.ini  "JumpPad" )
+    TriggerBox->SetCollisionProfileName(TEXT("JumpPad"));
+    TriggerBox->SetGenerateOverlapEvents(true);
 
     //   ⺻   (Ʈ Ʃ)
     JumpLaunchVelocityZ = 1500.0f; // ⺻ Z  ӵ
     JumpLaunchVelocityXY = 0.0f;  // ⺻   ӵ (ó 0 )
     TargetLandingLocation = FVector::ZeroVector; // ⺻  ǥ ġ
+
+    // AI  븦 ο   ֵ  ->  ġ ũ (ġ    )
+    NavLink = CreateDefaultSubobject<UNavLinkCustomComponent>(TEXT("NavLink"));
+    NavLink->SetLinkData(FVector::ZeroVector, FVector::ZeroVector, ENavLinkDirection::LeftToRight);
+
+    bBakedIntoCellData = false;
+    PadHandle = INDEX_NONE;
 }
 
 // Called when the game starts or when spawned
@@ -40,47 +44,106 @@ void AJumpActor::BeginPlay()
 {
     Super::BeginPlay();
 
+    //    AGameplayCellData     ϹǷ ޽ 
+    if (bBakedIntoCellData)
+    {
+        TriggerBox->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+        return;
+    }
+
+    // Ÿӿ   ġ    Ƿ ⼭   
+    if (!LaunchArc.IsValid())
+    {
+        UpdateLaunchArc();
+    }
+
+    if (UJumpPadSubsystem* JumpPads = GetWorld()->GetSubsystem<UJumpPadSubsystem>())
+    {
+        PadHandle = JumpPads->RegisterPad(this, TriggerBox, LaunchArc.LaunchVelocity);
+    }
 }
 
-// Ʈ ڽ   ̺Ʈ
-void AJumpActor::OnOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+void AJumpActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-    //  Ͱ ĳ Ȯ
-    ACharacter* Character = Cast<ACharacter>(OtherActor);
-    if (Character)
+    if (UJumpPadSubsystem* JumpPads = GetWorld()->GetSubsystem<UJumpPadSubsystem>())
     {
-        // ǥ ġ ư LaunchVelocity  (õ )
-        FVector CurrentCharacterXY = Character->GetActorLocation();
-        CurrentCharacterXY.Z = 0; // Z 
-        FVector TargetLandingXY = TargetLandingLocation;
-        TargetLandingXY.Z = 0; // Z 
+        JumpPads->UnregisterPad(PadHandle);
+    }
+    PadHandle = INDEX_NONE;
 
-        FVector HorizontalDirection = TargetLandingXY - CurrentCharacterXY;
-        HorizontalDirection.Normalize(); // ⸸ 
+    Super::EndPlay(EndPlayReason);
+}
 
-        FVector LaunchVelocity = HorizontalDirection * JumpLaunchVelocityXY;
-        LaunchVelocity.Z = JumpLaunchVelocityZ; // Z ӵ 
+void AJumpActor::OnConstruction(const FTransform& Transform)
+{
+    Super::OnConstruction(Transform);
 
-        // LaunchCharacter ȣ
-        Character->LaunchCharacter(LaunchVelocity, true, true); // XY Z   ӵ 
+    // ġ / ̵ / Ӽ    ũ ٽ 
+    UpdateLaunchArc();
+}
 
-        UE_LOG(LogTemp, Warning, TEXT("Character launched towards Target: %s with Velocity: %s"), *TargetLandingLocation.ToString(), *LaunchVelocity.ToString());
+void AJumpActor::UpdateLaunchArc()
+{
+    const UWorld* World = GetWorld();
+    LaunchArc = SolveArc(World ? World->GetGravityZ() : UPhysicsSettings::Get()->DefaultGravityZ);
 
-        // ( )   峪 ƼŬ 
-        // UGameplayStatics::PlaySoundAtLocation(this, JumpSound, GetActorLocation());
-        // UGameplayStatics::SpawnEmitterAtLocation(GetWorld(), JumpParticle, GetActorLocation());
+    // ǥ    ġ ǵ  ƴϹǷ AI ο  
+    const bool bHasTarget = HasTargetLandingLocation();
+    NavLink->SetNavigationRelevancy(bHasTarget);
+    if (!bHasTarget)
+    {
+        return;
     }
+
+    // ũ    ǥ
+    const FTransform& ActorTransform = GetActorTransform();
+    NavLink->SetLinkData(
+        ActorTransform.InverseTransformPosition(LaunchArc.LaunchLocation),
+        ActorTransform.InverseTransformPosition(LaunchArc.LandingLocation),
+        ENavLinkDirection::LeftToRight);
+    FNavigationSystem::UpdateComponentData(*NavLink);
 }
 
-//   ̺Ʈ (ʿ  )
-void AJumpActor::OnOverlapEnd(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
+FJumpPadArc AJumpActor::SolveArc(float GravityZ) const
 {
-    // UE_LOG(LogTemp, Warning, TEXT("Overlap ended with: %s"), *OtherActor->GetName());
+    FJumpPadArc Arc;
+    Arc.LaunchVelocity = ComputeLaunchVelocity();
+    Arc.LaunchLocation = TriggerBox->GetComponentLocation();
+    Arc.GravityZ = GravityZ;
+
+    // ǥ  ̿  : LaunchZ + Vz t + g t^2 / 2 = TargetZ  ū  (ǥ ġ  ߻ )
+    const float TargetZ = HasTargetLandingLocation() ? TargetLandingLocation.Z : Arc.LaunchLocation.Z;
+    const float A = 0.5f * GravityZ;
+    const float B = Arc.LaunchVelocity.Z;
+    const float C = Arc.LaunchLocation.Z - TargetZ;
+
+    if (A < -UE_KINDA_SMALL_NUMBER)
+    {
+        const float Discriminant = B * B - 4.0f * A * C;
+        if (Discriminant >= 0.0f)
+        {
+            Arc.FlightTime = (-B - FMath::Sqrt(Discriminant)) / (2.0f * A);
+        }
+        else
+        {
+            // ǥ ̿  :   ߻ ̷ ƿ  ü
+            Arc.FlightTime = -B / A;
+        }
+    }
+
+    Arc.FlightTime = FMath::Max(Arc.FlightTime, 0.0f);
+    Arc.LandingLocation = Arc.Evaluate(Arc.FlightTime);
+    return Arc;
 }
 
-// Called every frame
-void AJumpActor::Tick(float DeltaTime)
+FVector AJumpActor::ComputeLaunchVelocity() const
 {
-    Super::Tick(DeltaTime);
-
-}
\ No newline at end of file
+    // ǥ ġ ư LaunchVelocity  ( ġ , ġ   ). ǥ    ƴ  
+    const FVector HorizontalDirection = HasTargetLandingLocation()
+        ? (TargetLandingLocation - GetActorLocation()).GetSafeNormal2D() // ⸸  (Z )
+        : GetActorForwardVector().GetSafeNormal2D();
+
+    FVector LaunchVelocity = HorizontalDirection * JumpLaunchVelocityXY;
+    LaunchVelocity.Z = JumpLaunchVelocityZ; // Z ӵ 
+    return LaunchVelocity;
+}
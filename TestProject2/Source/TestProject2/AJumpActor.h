@@ -5,10 +5,53 @@
 #include "GameFramework/Actor.h"
 #include "Components/BoxComponent.h" // UBoxComponent  ߰
 
+class UNavLinkCustomComponent;
+
 //  Ϲ include  ڿ .generated.h  մϴ.
 #include "AJumpActor.generated.h" // <-- ġ ߽ϴ.
 // (: 𸮾 Ģ  Ŭ ̸ AJumpActor Generated  ̸ JumpActor.generated.h Դϴ.)
 
+/**
+ *  ߻  (ġ    Ͽ , Ÿӿ PredictProjectilePath  ).
+ * ̼ ũ  ġ ϸ, AI     ߻ ̷ϴ.      ÷  ǥÿ
+ */
+USTRUCT(BlueprintType)
+struct FJumpPadArc
+{
+    GENERATED_BODY()
+
+    /** ߻ ӵ */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Jump Pad")
+    FVector LaunchVelocity = FVector::ZeroVector;
+
+    /** ߻ ġ (Ʈ ڽ ߽) */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Jump Pad")
+    FVector LaunchLocation = FVector::ZeroVector;
+
+    /**  ġ (ǥ  ̿ ϴ ) */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Jump Pad")
+    FVector LandingLocation = FVector::ZeroVector;
+
+    /**  ð ( ð ). ð ̴   ٲ   ð FlightTime /  */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Jump Pad")
+    float FlightTime = 0.0f;
+
+    /** 꿡  ߷ (cm/s^2) */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Jump Pad")
+    float GravityZ = 0.0f;
+
+    bool IsValid() const { return FlightTime > 0.0f; }
+
+    /** ߻  Time  ( ð)  ġ */
+    FVector Evaluate(float Time) const
+    {
+        return LaunchLocation + LaunchVelocity * Time + FVector(0.0f, 0.0f, 0.5f * GravityZ * Time * Time);
+    }
+};
+
+/**
+ * . ƽ , Ʈ ڽ ߻ ӵ UJumpPadSubsystem  ϸ  ó ߻ ý մϴ.
+ */
 UCLASS()
 class TESTPROJECT2_API AJumpActor : public AActor
 {
@@ -18,15 +61,37 @@ public:
     // Sets default values for this actor's properties
     AJumpActor();
 
+    /** ġ ġ ǥ  ġ ϴ ߻ ӵ (    , ǥ   ) */
+    FVector ComputeLaunchVelocity() const;
+
+    /** ߷° ߻ ӵ  /  ð /  ġ  */
+    FJumpPadArc SolveArc(float GravityZ) const;
+
+    /** ġ    */
+    const FJumpPadArc& GetLaunchArc() const { return LaunchArc; }
+
+    virtual void OnConstruction(const FTransform& Transform) override;
+
+    /** ߻  */
+    UBoxComponent* GetTriggerBox() const { return TriggerBox; }
+
+    /** ߻  AGameplayCellData   (  Ÿӿ  Ͱ   ) */
+    bool IsBakedIntoCellData() const { return bBakedIntoCellData; }
+
+#if WITH_EDITOR
+    void SetBakedIntoCellData(bool bBaked) { bBakedIntoCellData = bBaked; }
+#endif
+
 protected:
     // Called when the game starts or when spawned
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
     /**    ޽ Ʈ */
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
     UStaticMeshComponent* JumpPadMesh;
 
-    /** ĳͰ 뿡 Ҵ ϴ ݸ ڽ */
+    /** ĳͰ 뿡 Ҵ ϴ ݸ ڽ (JumpPad ä, Pawn  ) */
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
     UBoxComponent* TriggerBox;
 
@@ -38,19 +103,27 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Jump Pad")
     float JumpLaunchVelocityXY;
 
-    /**   ĳͰ  ǥ ġ ( ǥ) */
+    /**   ĳͰ  ǥ ġ ( ǥ). (0, 0, 0) ̸ ǥ :  ߻ϰ ̼ ũ   */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Jump Pad")
     FVector TargetLandingLocation;
 
-    // Ʈ ڽ  ̺Ʈ Լ
-    UFUNCTION()
-    void OnOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
+    bool HasTargetLandingLocation() const { return !TargetLandingLocation.IsZero(); }
 
-    // ( )   ̺Ʈ Լ
-    UFUNCTION()
-    void OnOverlapEnd(UPrimitiveComponent* OverlappedComp, AActor* OtherComponent, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex);
+    /**  ->  ġ ܹ ̼ ũ (AI  Ž,    ) */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+    UNavLinkCustomComponent* NavLink;
 
-public:
-    // Called every frame
-    virtual void Tick(float DeltaTime) override;
-};
\ No newline at end of file
+    /** ġ    ( ǹǷ ŷ ӿ ٽ  ) */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Jump Pad")
+    FJumpPadArc LaunchArc;
+
+    /**  ϰ ̼ ũ  ġ  (ǥ  ũ ̼ǿ ) */
+    void UpdateLaunchArc();
+
+    /** AGameplayCellData    */
+    UPROPERTY(VisibleAnywhere, AdvancedDisplay, Category = "Jump Pad")
+    bool bBakedIntoCellData;
+
+    /** UJumpPadSubsystem  ڵ */
+    int32 PadHandle;
+};
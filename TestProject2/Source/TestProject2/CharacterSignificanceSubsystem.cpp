@@ -0,0 +1,128 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CharacterSignificanceSubsystem.h"
+#include "TestProject2Character.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "AnimationBudgetAllocatorParameters.h"
+#include "IAnimationBudgetAllocator.h"
+#include "SignificanceManager.h"
+
+namespace CharacterSignificance
+{
+	static const FName Tag(TEXT("TestProject2Character"));
+}
+
+bool UCharacterSignificanceSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	return Super::ShouldCreateSubsystem(Outer) && Levels.Num() > 0;
+}
+
+void UCharacterSignificanceSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (IAnimationBudgetAllocator* Allocator = IAnimationBudgetAllocator::Get(&InWorld))
+	{
+		FAnimationBudgetAllocatorParameters Parameters;
+		Parameters.BudgetInMs = AnimationBudgetMs;
+		Allocator->SetParameters(Parameters);
+		Allocator->SetEnabled(true);
+	}
+}
+
+void UCharacterSignificanceSubsystem::RegisterCharacter(ATestProject2Character* Character)
+{
+	USignificanceManager* SignificanceManager = USignificanceManager::Get(GetWorld());
+	if (SignificanceManager == nullptr || Character == nullptr)
+	{
+		return;
+	}
+
+	SignificanceManager->RegisterObject(Character, CharacterSignificance::Tag,
+		[this](USignificanceManager::FManagedObjectInfo* ObjectInfo, const FTransform& Viewpoint)
+		{
+			return CalculateSignificance(*CastChecked<ATestProject2Character>(ObjectInfo->GetObject()), Viewpoint);
+		},
+		USignificanceManager::EPostSignificanceType::Sequential,
+		[this](USignificanceManager::FManagedObjectInfo* ObjectInfo, float OldSignificance, float Significance, bool bFinal)
+		{
+			CastChecked<ATestProject2Character>(ObjectInfo->GetObject())->ApplySignificance(GetLevelForSignificance(Significance), Significance);
+		});
+}
+
+void UCharacterSignificanceSubsystem::UnregisterCharacter(ATestProject2Character* Character)
+{
+	if (USignificanceManager* SignificanceManager = USignificanceManager::Get(GetWorld()))
+	{
+		SignificanceManager->UnregisterObject(Character);
+	}
+}
+
+float UCharacterSignificanceSubsystem::GetMaxDistance() const
+{
+	return Levels.Num() > 0 ? FMath::Max(Levels.Last().MaxDistance, 1.0f) : 1.0f;
+}
+
+float UCharacterSignificanceSubsystem::CalculateSignificance(const ATestProject2Character& Character, const FTransform& Viewpoint) const
+{
+	// 로컬 플레이어 캐릭터는 항상 최고 단계 (AI 는 거리로 예산 배분)
+	if (Character.IsLocalPlayerControlled())
+	{
+		return 1.0f;
+	}
+
+	const FVector ToCharacter = Character.GetActorLocation() - Viewpoint.GetLocation();
+	const bool bInFront = FVector::DotProduct(ToCharacter, Viewpoint.GetUnitAxis(EAxis::X)) >= 0.0f;
+	const float EffectiveDistance = ToCharacter.Size() * (bInFront ? 1.0f : OffscreenDistanceScale);
+
+	return 1.0f - FMath::Clamp(EffectiveDistance / GetMaxDistance(), 0.0f, 1.0f);
+}
+
+const FCharacterSignificanceLevel& UCharacterSignificanceSubsystem::GetLevelForSignificance(float Significance) const
+{
+	const float EffectiveDistance = (1.0f - Significance) * GetMaxDistance();
+	for (const FCharacterSignificanceLevel& Level : Levels)
+	{
+		if (EffectiveDistance <= Level.MaxDistance)
+		{
+			return Level;
+		}
+	}
+	return Levels.Last();
+}
+
+void UCharacterSignificanceSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	USignificanceManager* SignificanceManager = USignificanceManager::Get(GetWorld());
+	if (SignificanceManager == nullptr)
+	{
+		return;
+	}
+
+	// 모든 플레이어 컨트롤러의 시점 (데디케이티드 서버에서는 원격 플레이어 폰 시점)
+	Viewpoints.Reset();
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		if (const APlayerController* PlayerController = It->Get())
+		{
+			FVector Location;
+			FRotator Rotation;
+			PlayerController->GetPlayerViewPoint(Location, Rotation);
+			Viewpoints.Emplace(Rotation, Location);
+		}
+	}
+
+	// 시점이 없으면 (플레이어가 아직 없음) 마지막 단계 설정을 유지
+	if (Viewpoints.Num() > 0)
+	{
+		SignificanceManager->Update(Viewpoints);
+	}
+}
+
+TStatId UCharacterSignificanceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UCharacterSignificanceSubsystem, STATGROUP_Tickables);
+}
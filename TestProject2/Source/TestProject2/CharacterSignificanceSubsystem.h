@@ -0,0 +1,78 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CharacterSignificanceSubsystem.generated.h"
+
+class ATestProject2Character;
+
+/** 중요도 단계 하나의 설정 (가까운 단계부터) */
+USTRUCT()
+struct FCharacterSignificanceLevel
+{
+	GENERATED_BODY()
+
+	/** 이 단계에 속하는 최대 유효 거리 (화면 밖이면 OffscreenDistanceScale 배) */
+	UPROPERTY(EditAnywhere, Category = "Significance")
+	float MaxDistance = 0.0f;
+
+	/** 액터 / 이동 컴포넌트 틱 간격 (초, 0 = 매 프레임). 로컬 조종 캐릭터에는 적용하지 않음 */
+	UPROPERTY(EditAnywhere, Category = "Significance")
+	float TickInterval = 0.0f;
+
+	/** 레지 프로브 발행 간격 (프레임) */
+	UPROPERTY(EditAnywhere, Category = "Significance")
+	int32 LedgeProbeIntervalFrames = 1;
+
+	/** 카메라 붐 / 슬로우 모션 후처리 / 오디오 갱신 여부 */
+	UPROPERTY(EditAnywhere, Category = "Significance")
+	bool bPresentationEffects = false;
+};
+
+/**
+ * 캐릭터를 Significance Manager 에 등록하고, 뷰포인트와의 거리 / 화면 안 여부로 정한 중요도 단계에 따라
+ * 틱 간격, 레지 프로브 빈도, 연출 갱신을 조절합니다. 스켈레탈 애니메이션은 같은 중요도를 Animation Budget Allocator 에
+ * 전달하여 설정된 ms 예산 안에서 틱 / 보간을 나눕니다.
+ */
+UCLASS(config = Game)
+class TESTPROJECT2_API UCharacterSignificanceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	void RegisterCharacter(ATestProject2Character* Character);
+	void UnregisterCharacter(ATestProject2Character* Character);
+
+	/** 중요도 값 (0.0 ~ 1.0) 에 해당하는 단계 설정 */
+	const FCharacterSignificanceLevel& GetLevelForSignificance(float Significance) const;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+protected:
+	/** 가까운 단계부터 나열한 중요도 단계. 마지막 단계의 MaxDistance 밖은 모두 마지막 단계 */
+	UPROPERTY(config)
+	TArray<FCharacterSignificanceLevel> Levels;
+
+	/** 뷰포인트 뒤쪽 (화면 밖) 캐릭터의 거리 배율 */
+	UPROPERTY(config)
+	float OffscreenDistanceScale = 2.0f;
+
+	/** 스켈레탈 애니메이션 게임 스레드 예산 (ms / 프레임) */
+	UPROPERTY(config)
+	float AnimationBudgetMs = 2.0f;
+
+private:
+	float CalculateSignificance(const ATestProject2Character& Character, const FTransform& Viewpoint) const;
+
+	/** 마지막 단계의 MaxDistance (중요도 0 에 해당하는 거리) */
+	float GetMaxDistance() const;
+
+	TArray<FTransform> Viewpoints;
+};
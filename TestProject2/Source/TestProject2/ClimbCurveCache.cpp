@@ -0,0 +1,74 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ClimbCurveCache.h"
+#include "Curves/CurveFloat.h"
+
+TMap<TObjectKey<UCurveFloat>, TWeakPtr<const FBakedCurve>> FClimbCurveCache::BakedCurves;
+
+void FBakedCurve::Bake(const UCurveFloat& Curve)
+{
+	for (int32 Index = 0; Index <= NumSamples; ++Index)
+	{
+		Samples[Index] = Curve.GetFloatValue(static_cast<float>(Index) / NumSamples);
+	}
+	Samples[NumSamples + 1] = Samples[NumSamples];
+}
+
+void FBakedCurve::BakeLinear()
+{
+	for (int32 Index = 0; Index <= NumSamples; ++Index)
+	{
+		Samples[Index] = static_cast<float>(Index) / NumSamples;
+	}
+	Samples[NumSamples + 1] = Samples[NumSamples];
+}
+
+void FBakedCurve::EvaluateBatch(TConstArrayView<float> Alphas, TArrayView<float> OutValues) const
+{
+	check(Alphas.Num() == OutValues.Num());
+
+	// 분기 없는 단순 루프라 컴파일러가 벡터화할 수 있음
+	const int32 Num = Alphas.Num();
+	for (int32 Index = 0; Index < Num; ++Index)
+	{
+		OutValues[Index] = Evaluate(Alphas[Index]);
+	}
+}
+
+TSharedRef<const FBakedCurve> FClimbCurveCache::FindOrBake(const UCurveFloat* Curve)
+{
+	check(IsInGameThread());
+
+	if (Curve == nullptr)
+	{
+		static const TSharedRef<const FBakedCurve> Linear = []()
+		{
+			TSharedRef<FBakedCurve> Baked = MakeShared<FBakedCurve>();
+			Baked->BakeLinear();
+			return Baked;
+		}();
+		return Linear;
+	}
+
+	if (const TWeakPtr<const FBakedCurve>* Entry = BakedCurves.Find(Curve))
+	{
+		if (TSharedPtr<const FBakedCurve> Existing = Entry->Pin())
+		{
+			return Existing.ToSharedRef();
+		}
+	}
+
+	// 만료된 항목 정리 (커브 수는 많지 않으므로 새로 구울 때만)
+	for (auto It = BakedCurves.CreateIterator(); It; ++It)
+	{
+		if (!It.Value().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	TSharedRef<FBakedCurve> Baked = MakeShared<FBakedCurve>();
+	Baked->Bake(*Curve);
+	BakedCurves.Add(Curve, Baked);
+	return Baked;
+}
@@ -0,0 +1,52 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class UCurveFloat;
+
+/**
+ * 정규화 시간 [0, 1] 구간의 UCurveFloat 를 고정 크기 샘플 테이블로 구운 결과.
+ * 평가는 키 탐색 / 스플라인 계산 없이 clamp + 선형 보간 한 번이며 분기가 없습니다.
+ */
+struct TESTPROJECT2_API FBakedCurve
+{
+	/** 보간 구간 수 (샘플은 NumSamples + 1 개, 마지막 구간 보간용으로 한 개 더 복제) */
+	static constexpr int32 NumSamples = 64;
+
+	/** 66 개 float (264 바이트) 로 캐시 라인 몇 개에 들어감 */
+	alignas(16) float Samples[NumSamples + 2];
+
+	/** 커브를 [0, 1] 에서 균일하게 샘플링 */
+	void Bake(const UCurveFloat& Curve);
+
+	/** 항등 커브 (커브가 없을 때 Alpha 그대로) */
+	void BakeLinear();
+
+	FORCEINLINE float Evaluate(float Alpha) const
+	{
+		const float Position = FMath::Clamp(Alpha, 0.0f, 1.0f) * NumSamples;
+		const int32 Index = static_cast<int32>(Position);
+		const float Fraction = Position - static_cast<float>(Index);
+		return Samples[Index] + (Samples[Index + 1] - Samples[Index]) * Fraction;
+	}
+
+	/** 여러 진행률을 한 번에 평가 (UClimbSubsystem 이 같은 커브를 쓰는 올라가기들의 진행률 배열을 넘김) */
+	void EvaluateBatch(TConstArrayView<float> Alphas, TArrayView<float> OutValues) const;
+};
+
+/**
+ * 구운 커브 테이블을 커브 에셋별로 공유합니다. 게임 스레드 전용입니다.
+ * 테이블은 사용하는 쪽이 모두 놓으면 해제되므로, 에디터에서 커브를 수정하면 다음 플레이부터 반영됩니다.
+ */
+class TESTPROJECT2_API FClimbCurveCache
+{
+public:
+	/** Curve 를 구운 테이블을 반환 (처음 요청 시 굽기). Curve 가 없으면 항등 테이블 */
+	static TSharedRef<const FBakedCurve> FindOrBake(const UCurveFloat* Curve);
+
+private:
+	static TMap<TObjectKey<UCurveFloat>, TWeakPtr<const FBakedCurve>> BakedCurves;
+};
@@ -0,0 +1,213 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ClimbSubsystem.h"
+#include "ClimbingMovementComponent.h"
+#include "ClimbCurveCache.h"
+#include "TestProject2.h"
+#include "Async/ParallelFor.h"
+#include "GameFramework/Character.h"
+
+void UClimbSubsystem::AddClimb(UClimbingMovementComponent* Movement, const FVector& StartLocation, const FVector& TargetLocation, float Duration, const TSharedPtr<const FBakedCurve>& ZOffsetCurve)
+{
+	check(Movement && Movement->ClimbBatchIndex == INDEX_NONE);
+
+	ACharacter* Character = Movement->GetCharacterOwner();
+
+	Movement->ClimbBatchIndex = Movements.Add(Movement);
+	StartLocations.Add(StartLocation);
+	TargetLocations.Add(TargetLocation);
+	Elapsed.Add(0.0f);
+	Durations.Add(Duration);
+	TimeScales.Add(Character ? Character->CustomTimeDilation : 1.0f);
+	CurveIndices.Add(FindOrAddCurve(ZOffsetCurve));
+
+	// 올라가는 동안 위치는 이 서브시스템이 갱신하므로 캐릭터 / 이동 컴포넌트는 틱할 필요가 없음
+	// 등록 전에 이미 꺼져 있던 틱 (중요도 컬링 / 예산 할당 등) 은 해제할 때 다시 켜지 않음
+	Movement->bRestoreComponentTickAfterClimb = Movement->IsComponentTickEnabled();
+	Movement->bRestoreActorTickAfterClimb = Character && Character->IsActorTickEnabled();
+	Movement->SetComponentTickEnabled(false);
+	if (Movement->bRestoreActorTickAfterClimb)
+	{
+		Character->SetActorTickEnabled(false);
+	}
+}
+
+void UClimbSubsystem::RemoveClimb(UClimbingMovementComponent* Movement)
+{
+	const int32 Index = Movement ? Movement->ClimbBatchIndex : INDEX_NONE;
+	if (!Movements.IsValidIndex(Index) || Movements[Index].Get() != Movement)
+	{
+		return;
+	}
+
+	Movement->ClimbBatchIndex = INDEX_NONE;
+	if (Movement->bRestoreComponentTickAfterClimb)
+	{
+		Movement->SetComponentTickEnabled(true);
+		Movement->bRestoreComponentTickAfterClimb = false;
+	}
+	if (Movement->bRestoreActorTickAfterClimb)
+	{
+		if (ACharacter* Character = Movement->GetCharacterOwner())
+		{
+			Character->SetActorTickEnabled(true);
+		}
+		Movement->bRestoreActorTickAfterClimb = false;
+	}
+
+	RemoveAtSwap(Index);
+}
+
+void UClimbSubsystem::RemoveAtSwap(int32 Index)
+{
+	Movements.RemoveAtSwap(Index, EAllowShrinking::No);
+	StartLocations.RemoveAtSwap(Index, EAllowShrinking::No);
+	TargetLocations.RemoveAtSwap(Index, EAllowShrinking::No);
+	Elapsed.RemoveAtSwap(Index, EAllowShrinking::No);
+	Durations.RemoveAtSwap(Index, EAllowShrinking::No);
+	TimeScales.RemoveAtSwap(Index, EAllowShrinking::No);
+	CurveIndices.RemoveAtSwap(Index, EAllowShrinking::No);
+
+	// 마지막 올라가기가 빈 자리로 옮겨졌으면 인덱스 갱신
+	if (Movements.IsValidIndex(Index))
+	{
+		if (UClimbingMovementComponent* Moved = Movements[Index].Get())
+		{
+			Moved->ClimbBatchIndex = Index;
+		}
+	}
+
+	if (Movements.Num() == 0)
+	{
+		Curves.Reset();
+	}
+}
+
+int32 UClimbSubsystem::FindOrAddCurve(const TSharedPtr<const FBakedCurve>& Curve)
+{
+	const TSharedPtr<const FBakedCurve> Table = Curve.IsValid() ? Curve : TSharedPtr<const FBakedCurve>(FClimbCurveCache::FindOrBake(nullptr));
+
+	const int32 Existing = Curves.IndexOfByKey(Table);
+	return Existing != INDEX_NONE ? Existing : Curves.Add(Table);
+}
+
+bool UClimbSubsystem::IsTickable() const
+{
+	return Movements.Num() > 0;
+}
+
+void UClimbSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	TP2_SCOPE_CYCLE_COUNTER(STAT_TP2_ClimbBatchUpdate);
+
+	if (DeltaTime < UCharacterMovementComponent::MIN_TICK_TIME)
+	{
+		return;
+	}
+
+	EvaluateClimbs(DeltaTime);
+	ApplyClimbs(DeltaTime);
+}
+
+void UClimbSubsystem::EvaluateClimbs(float DeltaTime)
+{
+	const int32 Num = Movements.Num();
+	Alphas.SetNumUninitialized(Num, EAllowShrinking::No);
+	ZAlphas.SetNumUninitialized(Num, EAllowShrinking::No);
+	NewLocations.SetNumUninitialized(Num, EAllowShrinking::No);
+
+	// 작업마다 연속된 구간의 배열 값만 읽고 쓰며, 커브 테이블은 읽기 전용.
+	// 구간 안에서 진행률 -> Z 커브 (같은 커브가 이어지는 부분마다 EvaluateBatch 한 번) -> 위치 순서로 계산
+	const int32 NumChunks = FMath::DivideAndRoundUp(Num, EvaluateChunkSize);
+	ParallelFor(TEXT("ClimbBatch"), NumChunks, 1, [this, DeltaTime, Num](int32 Chunk)
+	{
+		const int32 First = Chunk * EvaluateChunkSize;
+		const int32 Last = FMath::Min(First + EvaluateChunkSize, Num);
+
+		for (int32 Index = First; Index < Last; ++Index)
+		{
+			const float Duration = Durations[Index];
+			const float NewElapsed = FMath::Min(Elapsed[Index] + DeltaTime * TimeScales[Index], Duration);
+			Elapsed[Index] = NewElapsed;
+			Alphas[Index] = Duration > UE_KINDA_SMALL_NUMBER ? NewElapsed / Duration : 1.0f;
+		}
+
+		for (int32 RunStart = First; RunStart < Last;)
+		{
+			int32 RunEnd = RunStart + 1;
+			while (RunEnd < Last && CurveIndices[RunEnd] == CurveIndices[RunStart])
+			{
+				++RunEnd;
+			}
+			Curves[CurveIndices[RunStart]]->EvaluateBatch(TConstArrayView<float>(Alphas).Slice(RunStart, RunEnd - RunStart), TArrayView<float>(ZAlphas).Slice(RunStart, RunEnd - RunStart));
+			RunStart = RunEnd;
+		}
+
+		for (int32 Index = First; Index < Last; ++Index)
+		{
+			const FVector& Start = StartLocations[Index];
+			const FVector& Target = TargetLocations[Index];
+			const float Alpha = Alphas[Index];
+			NewLocations[Index] = FVector(
+				FMath::Lerp(Start.X, Target.X, Alpha),
+				FMath::Lerp(Start.Y, Target.Y, Alpha),
+				FMath::Lerp(Start.Z, Target.Z, ZAlphas[Index]));
+		}
+	});
+}
+
+void UClimbSubsystem::ApplyClimbs(float DeltaTime)
+{
+	// 끝난 올라가기는 적용 중에 RemoveClimb 으로 빠지며 마지막 항목이 그 자리로 옮겨짐.
+	// 뒤에서부터 돌면 옮겨지는 항목은 이미 적용했거나 이번 틱에 추가된 것이므로 건너뛰어도 됨
+	for (int32 Index = NewLocations.Num() - 1; Index >= 0; --Index)
+	{
+		if (!Movements.IsValidIndex(Index))
+		{
+			continue;
+		}
+
+		UClimbingMovementComponent* Movement = Movements[Index].Get();
+		if (Movement == nullptr)
+		{
+			// 컴포넌트가 EndPlay 없이 사라짐: 빈 항목 정리
+			RemoveAtSwap(Index);
+			continue;
+		}
+
+		if (const ACharacter* Character = Movement->GetCharacterOwner())
+		{
+			TimeScales[Index] = Character->CustomTimeDilation;
+		}
+
+		Movement->ApplyBatchedClimb(NewLocations[Index], Elapsed[Index], DeltaTime * TimeScales[Index]);
+	}
+}
+
+void UClimbSubsystem::Deinitialize()
+{
+	// 뒤에서부터 빼면 옮겨지는 항목 없이 틱만 복원됨
+	while (Movements.Num() > 0)
+	{
+		if (UClimbingMovementComponent* Movement = Movements.Last().Get())
+		{
+			RemoveClimb(Movement);
+		}
+		else
+		{
+			RemoveAtSwap(Movements.Num() - 1);
+		}
+	}
+	Alphas.Reset();
+	ZAlphas.Reset();
+	NewLocations.Reset();
+
+	Super::Deinitialize();
+}
+
+TStatId UClimbSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UClimbSubsystem, STATGROUP_Tickables);
+}
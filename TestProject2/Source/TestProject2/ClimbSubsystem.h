@@ -0,0 +1,78 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ClimbSubsystem.generated.h"
+
+class UClimbingMovementComponent;
+struct FBakedCurve;
+
+/**
+ * 서버 / 스탠드얼론에서 진행하는 올라가기를 캐릭터별 PhysCustom 대신 한 번에 갱신합니다.
+ * 진행 중인 올라가기를 필드별 배열 (시작 / 목표 / 경과 / 길이 / 커브 인덱스) 로 저장하고,
+ * ParallelFor 한 번으로 새 위치를 모두 계산한 뒤 게임 스레드에서 한 번에 적용합니다.
+ * 등록된 캐릭터는 올라가는 동안 액터 / 이동 컴포넌트 틱이 꺼집니다.
+ *
+ * 원격 클라이언트가 조종하는 캐릭터와 자율 프록시는 이동 예측 / 재실행과 맞아야 하므로 등록되지 않고
+ * 기존대로 UClimbingMovementComponent::PhysClimb 에서 진행합니다.
+ */
+UCLASS()
+class TESTPROJECT2_API UClimbSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** 올라가기 등록 (Movement 의 이동 모드가 CMOVE_Climb 으로 바뀐 직후) */
+	void AddClimb(UClimbingMovementComponent* Movement, const FVector& StartLocation, const FVector& TargetLocation, float Duration, const TSharedPtr<const FBakedCurve>& ZOffsetCurve);
+
+	/** 올라가기 해제 (끝났거나 다른 이동 모드로 끊김). 등록 때 켜져 있던 틱만 복원 */
+	void RemoveClimb(UClimbingMovementComponent* Movement);
+
+	/** 묶음으로 진행 중인 올라가기 수 */
+	int32 GetNumClimbs() const { return Movements.Num(); }
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+	virtual void Deinitialize() override;
+
+private:
+	/** 모든 올라가기의 경과 시간과 새 위치를 병렬로 계산 */
+	void EvaluateClimbs(float DeltaTime);
+
+	/** 계산한 위치를 컴포넌트에 적용 (끝난 올라가기는 이 안에서 해제됨) */
+	void ApplyClimbs(float DeltaTime);
+
+	/** 배열 항목 하나를 빼고 마지막 항목을 그 자리로 옮김 (틱 복원은 하지 않음) */
+	void RemoveAtSwap(int32 Index);
+
+	int32 FindOrAddCurve(const TSharedPtr<const FBakedCurve>& Curve);
+
+	/** 병렬 평가 작업 하나가 맡는 올라가기 수 (이하이면 게임 스레드에서 바로 계산) */
+	static constexpr int32 EvaluateChunkSize = 32;
+
+	// 같은 인덱스가 올라가기 하나. 평가 패스는 아래 배열만 순서대로 읽고 씀
+	TArray<TWeakObjectPtr<UClimbingMovementComponent>> Movements;
+	TArray<FVector> StartLocations;
+	TArray<FVector> TargetLocations;
+	TArray<float> Elapsed;
+	TArray<float> Durations;
+
+	/** 캐릭터 CustomTimeDilation (적용 패스에서 갱신, 다음 틱 평가에 사용) */
+	TArray<float> TimeScales;
+	TArray<int32> CurveIndices;
+
+	/** 평가 중간값: 진행률과 Z 커브 값 (FBakedCurve::EvaluateBatch 입출력) */
+	TArray<float> Alphas;
+	TArray<float> ZAlphas;
+
+	/** 평가 결과 (적용 패스 입력) */
+	TArray<FVector> NewLocations;
+
+	/** 올라가기들이 쓰는 Z 오프셋 커브 테이블 (CurveIndices 가 가리킴, 올라가기가 모두 끝나면 비움) */
+	TArray<TSharedPtr<const FBakedCurve>> Curves;
+};
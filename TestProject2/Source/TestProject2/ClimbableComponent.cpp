@@ -0,0 +1,95 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ClimbableComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+UClimbableComponent::UClimbableComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+
+	bGenerateLedgesFromCollision = true;
+	bBakedIntoCellData = false;
+	RegistrationHandle = INDEX_NONE;
+}
+
+void UClimbableComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// 구워진 레지는 이 액터가 속한 스트리밍 셀의 AGameplayCellData 가 등록
+	if (!bBakedIntoCellData)
+	{
+		Register();
+	}
+}
+
+void UClimbableComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	Unregister();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UClimbableComponent::RefreshLedges()
+{
+	Unregister();
+	Register();
+}
+
+void UClimbableComponent::GatherLedges(TArray<FClimbableLedge>& OutLedges) const
+{
+	const AActor* Owner = GetOwner();
+	if (Owner == nullptr)
+	{
+		return;
+	}
+
+	if (bGenerateLedgesFromCollision)
+	{
+		const UPrimitiveComponent* Primitive = Cast<UPrimitiveComponent>(Owner->GetRootComponent());
+		UClimbableSubsystem::BuildLedgesFromCollision(Primitive ? Primitive : Owner->FindComponentByClass<UPrimitiveComponent>(), OutLedges);
+	}
+
+	const FTransform& ActorTransform = Owner->GetActorTransform();
+	for (const FClimbableLedge& LocalLedge : AdditionalLedges)
+	{
+		FClimbableLedge& Ledge = OutLedges.Add_GetRef(LocalLedge);
+		Ledge.Start = ActorTransform.TransformPosition(LocalLedge.Start);
+		Ledge.End = ActorTransform.TransformPosition(LocalLedge.End);
+		Ledge.OutwardNormal = ActorTransform.TransformVectorNoScale(LocalLedge.OutwardNormal).GetSafeNormal2D();
+	}
+}
+
+void UClimbableComponent::Register()
+{
+	UClimbableSubsystem* Subsystem = UWorld::GetSubsystem<UClimbableSubsystem>(GetWorld());
+	AActor* Owner = GetOwner();
+	if (Subsystem == nullptr || Owner == nullptr)
+	{
+		return;
+	}
+
+	TArray<FClimbableLedge> Ledges;
+	GatherLedges(Ledges);
+
+	if (Ledges.Num() > 0)
+	{
+		RegistrationHandle = Subsystem->RegisterLedges(Owner, Ledges);
+	}
+}
+
+void UClimbableComponent::Unregister()
+{
+	if (RegistrationHandle == INDEX_NONE)
+	{
+		return;
+	}
+
+	if (UClimbableSubsystem* Subsystem = UWorld::GetSubsystem<UClimbableSubsystem>(GetWorld()))
+	{
+		Subsystem->UnregisterLedges(RegistrationHandle);
+	}
+	RegistrationHandle = INDEX_NONE;
+}
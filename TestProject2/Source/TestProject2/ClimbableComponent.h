@@ -0,0 +1,57 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "ClimbableSubsystem.h"
+#include "ClimbableComponent.generated.h"
+
+/**
+ * 액터를 올라갈 수 있는 오브젝트로 표시하고, 레지 모서리를 UClimbableSubsystem 에 등록합니다.
+ * 기존의 액터 태그 "Climbable" 을 대체합니다.
+ */
+UCLASS(ClassGroup = (Climbing), meta = (BlueprintSpawnableComponent))
+class TESTPROJECT2_API UClimbableComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UClimbableComponent();
+
+	/** 소유 액터가 움직인 뒤 레지를 다시 계산하여 등록 */
+	UFUNCTION(BlueprintCallable, Category = "Climbing")
+	void RefreshLedges();
+
+	/** 현재 액터 위치 기준 레지 모서리 (월드 좌표) 를 계산 */
+	void GatherLedges(TArray<FClimbableLedge>& OutLedges) const;
+
+	/** 레지가 AGameplayCellData 에 구워졌는지 (구워진 경우 런타임에는 셀 데이터가 대신 등록) */
+	bool IsBakedIntoCellData() const { return bBakedIntoCellData; }
+
+#if WITH_EDITOR
+	void SetBakedIntoCellData(bool bBaked) { bBakedIntoCellData = bBaked; }
+#endif
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/** 루트 프리미티브 충돌의 수평 윗면 모서리를 자동으로 레지로 등록할지 (끄면 AdditionalLedges 만 사용) */
+	UPROPERTY(EditAnywhere, Category = "Climbing")
+	bool bGenerateLedgesFromCollision;
+
+	/** 추가로 등록할 레지 모서리 (액터 기준 로컬 좌표) */
+	UPROPERTY(EditAnywhere, Category = "Climbing", meta = (MakeEditWidget))
+	TArray<FClimbableLedge> AdditionalLedges;
+
+	/** AGameplayCellData 빌드 시 설정됨 */
+	UPROPERTY(VisibleAnywhere, AdvancedDisplay, Category = "Climbing")
+	bool bBakedIntoCellData;
+
+private:
+	void Register();
+	void Unregister();
+
+	int32 RegistrationHandle;
+};
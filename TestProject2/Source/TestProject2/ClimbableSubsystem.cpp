@@ -0,0 +1,484 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ClimbableSubsystem.h"
+#include "ClimbableComponent.h"
+#include "TestProject2.h"
+#include "Components/BoxComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/PackageName.h"
+#include "PhysicsEngine/BodySetup.h"
+
+static FAutoConsoleCommandWithWorldAndArgs CmdClimbableReport(
+	TEXT("TestProject2.Climbable.Report"),
+	TEXT("올라갈 수 있는 레지 레지스트리의 크기와 조회 비용을 출력합니다."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (const UClimbableSubsystem* Subsystem = UWorld::GetSubsystem<UClimbableSubsystem>(World))
+		{
+			Subsystem->DumpStats(*GLog);
+		}
+	}));
+
+const FName UClimbableSubsystem::BakedClimbableTag(TEXT("ClimbableBaked"));
+
+namespace ClimbableLedges
+{
+	/** 윗면으로 볼 최고점과의 높이 차이 (cm) */
+	constexpr float TopFaceTolerance = 1.0f;
+
+	/** 이보다 짧은 모서리는 레지로 만들지 않음 (cm) */
+	constexpr float MinLedgeLength = 10.0f;
+
+	/** 수평 다각형 (윗면) 의 모서리를 바깥쪽 노멀과 함께 레지로 추가 */
+	static void AddPolygonLedges(TConstArrayView<FVector> Polygon, TArray<FClimbableLedge>& OutLedges)
+	{
+		if (Polygon.Num() < 3)
+		{
+			return;
+		}
+
+		FVector Center = FVector::ZeroVector;
+		for (const FVector& Point : Polygon)
+		{
+			Center += Point;
+		}
+		Center /= Polygon.Num();
+
+		for (int32 Index = 0; Index < Polygon.Num(); ++Index)
+		{
+			FClimbableLedge Ledge;
+			Ledge.Start = Polygon[Index];
+			Ledge.End = Polygon[(Index + 1) % Polygon.Num()];
+			if (FVector::DistSquared2D(Ledge.Start, Ledge.End) < FMath::Square(MinLedgeLength))
+			{
+				continue;
+			}
+
+			const FVector Direction = (Ledge.End - Ledge.Start).GetSafeNormal2D();
+			FVector Normal(Direction.Y, -Direction.X, 0.0f);
+			if (FVector::DotProduct(Normal, (Ledge.Start + Ledge.End) * 0.5f - Center) < 0.0f)
+			{
+				Normal = -Normal;
+			}
+			Ledge.OutwardNormal = Normal;
+
+			OutLedges.Add(Ledge);
+		}
+	}
+
+	/** 박스 (Transform 기준 ±Extent) 의 위를 향한 면이 수평이면 그 네 모서리를 추가 */
+	static void AddBoxTopLedges(const FTransform& Transform, const FVector& Extent, TArray<FClimbableLedge>& OutLedges)
+	{
+		const float UpZ = Transform.GetUnitAxis(EAxis::Z).Z;
+		if (FMath::Abs(UpZ) < 0.99f)
+		{
+			return;
+		}
+
+		// 뒤집힌 박스는 로컬 아래 면이 위쪽
+		const float TopZ = UpZ > 0.0f ? Extent.Z : -Extent.Z;
+		const FVector Corners[4] =
+		{
+			Transform.TransformPosition(FVector(-Extent.X, -Extent.Y, TopZ)),
+			Transform.TransformPosition(FVector(Extent.X, -Extent.Y, TopZ)),
+			Transform.TransformPosition(FVector(Extent.X, Extent.Y, TopZ)),
+			Transform.TransformPosition(FVector(-Extent.X, Extent.Y, TopZ)),
+		};
+		AddPolygonLedges(Corners, OutLedges);
+	}
+
+	/** XY 평면 볼록 껍질 (반시계 방향, Z 는 유지) */
+	static TArray<FVector> ConvexHull2D(TArray<FVector> Points)
+	{
+		if (Points.Num() < 3)
+		{
+			return {};
+		}
+
+		Points.Sort([](const FVector& A, const FVector& B) { return A.X < B.X || (A.X == B.X && A.Y < B.Y); });
+
+		auto Cross = [](const FVector& O, const FVector& A, const FVector& B)
+		{
+			return (A.X - O.X) * (B.Y - O.Y) - (A.Y - O.Y) * (B.X - O.X);
+		};
+
+		TArray<FVector> Hull;
+		Hull.Reserve(Points.Num() * 2);
+		for (int32 Pass = 0; Pass < 2; ++Pass)
+		{
+			const int32 LowerSize = Hull.Num();
+			for (int32 Step = 0; Step < Points.Num(); ++Step)
+			{
+				const FVector& Point = Points[Pass == 0 ? Step : Points.Num() - 1 - Step];
+				while (Hull.Num() >= LowerSize + 2 && Cross(Hull[Hull.Num() - 2], Hull.Last(), Point) <= UE_KINDA_SMALL_NUMBER)
+				{
+					Hull.Pop(EAllowShrinking::No);
+				}
+				Hull.Add(Point);
+			}
+			// 다음 패스의 시작점과 겹치는 끝점 제거
+			Hull.Pop(EAllowShrinking::No);
+		}
+		return Hull;
+	}
+}
+
+int32 UClimbableSubsystem::RegisterLedges(AActor* Owner, TConstArrayView<FClimbableLedge> InLedges)
+{
+	TArray<int32> GroupLedges;
+	GroupLedges.Reserve(InLedges.Num());
+
+	for (const FClimbableLedge& Ledge : InLedges)
+	{
+		FLedgeEntry Entry;
+		Entry.Ledge = Ledge;
+		Entry.Owner = Owner;
+
+		const int32 LedgeIndex = Ledges.Add(MoveTemp(Entry));
+		AddToCells(LedgeIndex);
+		GroupLedges.Add(LedgeIndex);
+	}
+
+	return Groups.Add(MoveTemp(GroupLedges));
+}
+
+void UClimbableSubsystem::UnregisterLedges(int32 Handle)
+{
+	if (!Groups.IsValidIndex(Handle))
+	{
+		return;
+	}
+
+	for (const int32 LedgeIndex : Groups[Handle])
+	{
+		RemoveFromCells(LedgeIndex);
+		Ledges.RemoveAt(LedgeIndex);
+	}
+	Groups.RemoveAt(Handle);
+}
+
+FIntPoint UClimbableSubsystem::GetCell(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+void UClimbableSubsystem::AddToCells(int32 LedgeIndex)
+{
+	const FClimbableLedge& Ledge = Ledges[LedgeIndex].Ledge;
+	const FIntPoint MinCell = GetCell(Ledge.Start.ComponentMin(Ledge.End));
+	const FIntPoint MaxCell = GetCell(Ledge.Start.ComponentMax(Ledge.End));
+
+	for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+	{
+		for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+		{
+			Cells.FindOrAdd(FIntPoint(X, Y)).Add(LedgeIndex);
+		}
+	}
+}
+
+void UClimbableSubsystem::RemoveFromCells(int32 LedgeIndex)
+{
+	const FClimbableLedge& Ledge = Ledges[LedgeIndex].Ledge;
+	const FIntPoint MinCell = GetCell(Ledge.Start.ComponentMin(Ledge.End));
+	const FIntPoint MaxCell = GetCell(Ledge.Start.ComponentMax(Ledge.End));
+
+	for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+	{
+		for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+		{
+			const FIntPoint Cell(X, Y);
+			if (TArray<int32>* CellLedges = Cells.Find(Cell))
+			{
+				CellLedges->RemoveSingleSwap(LedgeIndex, EAllowShrinking::No);
+				if (CellLedges->IsEmpty())
+				{
+					Cells.Remove(Cell);
+				}
+			}
+		}
+	}
+}
+
+bool UClimbableSubsystem::FindLedgeInFront(const FVector& FeetLocation, const FVector& Forward, float Reach, float MinHeight, float MaxHeight, FClimbableLedgeHit& OutHit) const
+{
+	TP2_SCOPE_CYCLE_COUNTER(STAT_TP2_FindLedgeInFront);
+	INC_DWORD_STAT(STAT_TP2_LedgeQueries);
+	CSV_CUSTOM_STAT(TestProject2, LedgeQueries, 1, ECsvCustomStatOp::Accumulate);
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	const uint32 Stamp = ++QueryStampCounter;
+	const FVector Forward2D = Forward.GetSafeNormal2D();
+	const FIntPoint MinCell = GetCell(FeetLocation - FVector(Reach, Reach, 0.0f));
+	const FIntPoint MaxCell = GetCell(FeetLocation + FVector(Reach, Reach, 0.0f));
+
+	float BestDistance = Reach;
+	int32 Candidates = 0;
+	bool bFound = false;
+
+	for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+	{
+		for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+		{
+			const TArray<int32>* CellLedges = Cells.Find(FIntPoint(X, Y));
+			if (CellLedges == nullptr)
+			{
+				continue;
+			}
+
+			for (const int32 LedgeIndex : *CellLedges)
+			{
+				const FLedgeEntry& Entry = Ledges[LedgeIndex];
+				if (Entry.QueryStamp == Stamp)
+				{
+					continue;
+				}
+				Entry.QueryStamp = Stamp;
+				++Candidates;
+
+				if (!Entry.Owner.IsValid())
+				{
+					continue;
+				}
+
+				const FClimbableLedge& Ledge = Entry.Ledge;
+				if (TestLedge(FeetLocation, Forward2D, Ledge.Start, Ledge.End, Ledge.OutwardNormal, MinHeight, MaxHeight, BestDistance, OutHit))
+				{
+					OutHit.Owner = Entry.Owner;
+					OutHit.Clearance = -1.0f;
+					bFound = true;
+				}
+			}
+		}
+	}
+
+	// 맵의 정적 레지 (소유 액터 없음)
+	if (LedgeDatabase.IsValid())
+	{
+		LedgeDatabase->ForEachLedgeNear(FeetLocation, Reach, [&](const LedgeDatabase::FLedge& Ledge)
+		{
+			++Candidates;
+			if (Ledge.Clearance < MinLedgeClearance)
+			{
+				return;
+			}
+
+			const FVector OutwardNormal(Ledge.OutwardNormal.X, Ledge.OutwardNormal.Y, 0.0f);
+			if (TestLedge(FeetLocation, Forward2D, FVector(Ledge.Start), FVector(Ledge.End), OutwardNormal, MinHeight, MaxHeight, BestDistance, OutHit))
+			{
+				OutHit.Owner.Reset();
+				OutHit.Clearance = Ledge.Clearance;
+				bFound = true;
+			}
+		});
+	}
+
+	++NumQueries;
+	TotalQueryCycles += FPlatformTime::Cycles64() - StartCycles;
+	TotalCandidatesTested += Candidates;
+	LastQueryCandidates = Candidates;
+
+	return bFound;
+}
+
+bool UClimbableSubsystem::TestLedge(const FVector& FeetLocation, const FVector& Forward2D, const FVector& Start, const FVector& End, const FVector& OutwardNormal,
+	float MinHeight, float MaxHeight, float& InOutBestDistance, FClimbableLedgeHit& OutHit) const
+{
+	const float Height = Start.Z - FeetLocation.Z;
+	if (Height < MinHeight || Height > MaxHeight)
+	{
+		return false;
+	}
+
+	// 벽면을 마주보고 있어야 함
+	if (FVector::DotProduct(Forward2D, -OutwardNormal) < MinFacingDot)
+	{
+		return false;
+	}
+
+	const FVector FeetOnLedgePlane(FeetLocation.X, FeetLocation.Y, Start.Z);
+	const FVector ClosestPoint = FMath::ClosestPointOnSegment(FeetOnLedgePlane, Start, End);
+	const FVector ToLedge = ClosestPoint - FeetOnLedgePlane;
+	const float Distance = ToLedge.Size2D();
+	if (Distance >= InOutBestDistance || (Distance > KINDA_SMALL_NUMBER && FVector::DotProduct(Forward2D, ToLedge / Distance) < MinFacingDot))
+	{
+		return false;
+	}
+
+	InOutBestDistance = Distance;
+	OutHit.ClosestPoint = ClosestPoint;
+	OutHit.OutwardNormal = OutwardNormal;
+	OutHit.Distance = Distance;
+	OutHit.Height = Height;
+	return true;
+}
+
+void UClimbableSubsystem::DumpStats(FOutputDevice& Ar) const
+{
+	SIZE_T CellBytes = Cells.GetAllocatedSize();
+	for (const TPair<FIntPoint, TArray<int32>>& Pair : Cells)
+	{
+		CellBytes += Pair.Value.GetAllocatedSize();
+	}
+
+	const double AverageQueryUs = NumQueries > 0 ? FPlatformTime::ToMilliseconds64(TotalQueryCycles) * 1000.0 / NumQueries : 0.0;
+	const double AverageCandidates = NumQueries > 0 ? double(TotalCandidatesTested) / NumQueries : 0.0;
+
+	Ar.Logf(TEXT("Climbable registry: %d ledges in %d groups, %d cells (cell size %.0f), %.1f KB"),
+		Ledges.Num(), Groups.Num(), Cells.Num(), CellSize, (Ledges.GetAllocatedSize() + Groups.GetAllocatedSize() + CellBytes) / 1024.0);
+	if (LedgeDatabase.IsValid())
+	{
+		Ar.Logf(TEXT("Ledge database: %d ledges, %d cells (cell size %.0f), %.1f KB mapped"),
+			LedgeDatabase->GetNumLedges(), LedgeDatabase->GetNumCells(), LedgeDatabase->GetCellSize(), LedgeDatabase->GetSizeBytes() / 1024.0);
+	}
+	Ar.Logf(TEXT("Climbable queries: %llu total, %.2f us avg, %.1f candidates avg, %d candidates last"),
+		NumQueries, AverageQueryUs, AverageCandidates, LastQueryCandidates);
+}
+
+void UClimbableSubsystem::BuildLedgesFromCollision(const UPrimitiveComponent* Primitive, TArray<FClimbableLedge>& OutLedges)
+{
+	if (Primitive == nullptr || !Primitive->IsCollisionEnabled())
+	{
+		return;
+	}
+
+	const FTransform& ComponentTransform = Primitive->GetComponentTransform();
+
+	if (const UBoxComponent* Box = Cast<UBoxComponent>(Primitive))
+	{
+		ClimbableLedges::AddBoxTopLedges(ComponentTransform, Box->GetUnscaledBoxExtent(), OutLedges);
+		return;
+	}
+
+	// 메쉬는 단순 충돌의 박스 / 컨벡스 요소 윗면만 사용 (경사로 / 원기둥처럼 수평 윗면이 없으면 레지 없음)
+	const UBodySetup* BodySetup = Primitive->GetBodySetup();
+	if (BodySetup == nullptr)
+	{
+		return;
+	}
+
+	for (const FKBoxElem& Box : BodySetup->AggGeom.BoxElems)
+	{
+		ClimbableLedges::AddBoxTopLedges(Box.GetTransform() * ComponentTransform, FVector(Box.X, Box.Y, Box.Z) * 0.5f, OutLedges);
+	}
+
+	TArray<FVector> TopVertices;
+	for (const FKConvexElem& Convex : BodySetup->AggGeom.ConvexElems)
+	{
+		const FTransform ElemTransform = Convex.GetTransform() * ComponentTransform;
+
+		float MaxZ = -UE_BIG_NUMBER;
+		for (const FVector& Vertex : Convex.VertexData)
+		{
+			MaxZ = FMath::Max(MaxZ, ElemTransform.TransformPosition(Vertex).Z);
+		}
+
+		TopVertices.Reset();
+		for (const FVector& Vertex : Convex.VertexData)
+		{
+			const FVector WorldVertex = ElemTransform.TransformPosition(Vertex);
+			if (WorldVertex.Z >= MaxZ - ClimbableLedges::TopFaceTolerance)
+			{
+				TopVertices.Add(FVector(WorldVertex.X, WorldVertex.Y, MaxZ));
+			}
+		}
+		ClimbableLedges::AddPolygonLedges(ClimbableLedges::ConvexHull2D(TopVertices), OutLedges);
+	}
+}
+
+void UClimbableSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// 쿠킹 전에 추출한 정적 레지가 있으면 매핑만 하고, 태그 액터 검색은 생략 (같은 지오메트리가 이미 들어 있음)
+	const FString MapName = UWorld::RemovePIEPrefix(FPackageName::GetShortName(InWorld.GetOutermost()->GetName()));
+	LedgeDatabase = FLedgeDatabase::Open(FLedgeDatabase::GetFilenameForMap(MapName));
+	if (LedgeDatabase.IsValid())
+	{
+		return;
+	}
+
+	RegisterLegacyTaggedActors(InWorld);
+}
+
+void UClimbableSubsystem::RegisterLegacyTaggedActors(UWorld& InWorld)
+{
+	for (ULevel* Level : InWorld.GetLevels())
+	{
+		if (Level && Level->bIsVisible)
+		{
+			RegisterLegacyTaggedActors(*Level);
+		}
+	}
+
+	// 파티션 월드에서는 시작 시 로드된 셀만 보이므로 나머지 셀은 스트리밍되어 들어올 때 등록
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &UClimbableSubsystem::OnLevelAddedToWorld);
+	LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &UClimbableSubsystem::OnLevelRemovedFromWorld);
+}
+
+void UClimbableSubsystem::RegisterLegacyTaggedActors(ULevel& Level)
+{
+	static const FName ClimbableTag(TEXT("Climbable"));
+
+	if (LegacyGroupsByLevel.Contains(&Level))
+	{
+		return;
+	}
+	TArray<int32>& LevelGroups = LegacyGroupsByLevel.Add(&Level);
+
+	TArray<FClimbableLedge> ActorLedges;
+	for (AActor* Actor : Level.Actors)
+	{
+		// 구워진 액터의 레지는 셀의 AGameplayCellData 가 등록
+		if (Actor == nullptr || !Actor->Tags.Contains(ClimbableTag) || Actor->Tags.Contains(BakedClimbableTag) || Actor->FindComponentByClass<UClimbableComponent>())
+		{
+			continue;
+		}
+
+		ActorLedges.Reset();
+		const UPrimitiveComponent* Primitive = Cast<UPrimitiveComponent>(Actor->GetRootComponent());
+		BuildLedgesFromCollision(Primitive ? Primitive : Actor->FindComponentByClass<UPrimitiveComponent>(), ActorLedges);
+		if (ActorLedges.Num() > 0)
+		{
+			LevelGroups.Add(RegisterLedges(Actor, ActorLedges));
+		}
+	}
+}
+
+void UClimbableSubsystem::OnLevelAddedToWorld(ULevel* Level, UWorld* World)
+{
+	if (Level && World == GetWorld())
+	{
+		RegisterLegacyTaggedActors(*Level);
+	}
+}
+
+void UClimbableSubsystem::OnLevelRemovedFromWorld(ULevel* Level, UWorld* World)
+{
+	TArray<int32> LevelGroups;
+	if (World == GetWorld() && LegacyGroupsByLevel.RemoveAndCopyValue(Level, LevelGroups))
+	{
+		for (const int32 Handle : LevelGroups)
+		{
+			UnregisterLedges(Handle);
+		}
+	}
+}
+
+void UClimbableSubsystem::Deinitialize()
+{
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+	FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+	LegacyGroupsByLevel.Empty();
+
+	Ledges.Empty();
+	Groups.Empty();
+	Cells.Empty();
+	LedgeDatabase.Reset();
+
+	Super::Deinitialize();
+}
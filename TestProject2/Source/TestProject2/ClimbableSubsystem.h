@@ -0,0 +1,160 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "LedgeDatabase.h"
+#include "ClimbableSubsystem.generated.h"
+
+/** 올라갈 수 있는 레지 모서리 하나 (월드 좌표, 수평 선분) */
+USTRUCT(BlueprintType)
+struct FClimbableLedge
+{
+	GENERATED_BODY()
+
+	/** 모서리 시작점 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Ledge")
+	FVector Start = FVector::ZeroVector;
+
+	/** 모서리 끝점 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Ledge")
+	FVector End = FVector::ZeroVector;
+
+	/** 벽면 바깥쪽을 향하는 수평 노멀 (캐릭터가 다가오는 쪽) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Ledge")
+	FVector OutwardNormal = FVector::ForwardVector;
+};
+
+/** 전방 레지 조회 결과 */
+struct FClimbableLedgeHit
+{
+	/** 레지 모서리 위에서 캐릭터에 가장 가까운 점 (레지 윗면 높이) */
+	FVector ClosestPoint = FVector::ZeroVector;
+
+	/** 벽면 바깥쪽 수평 노멀 */
+	FVector OutwardNormal = FVector::ForwardVector;
+
+	/** 발 위치에서 모서리까지 수평 거리 */
+	float Distance = 0.0f;
+
+	/** 발바닥 기준 레지 높이 */
+	float Height = 0.0f;
+
+	/** 레지 윗면 위의 여유 높이 (레지 데이터베이스에서 미리 계산된 경우만, 그 외에는 음수) */
+	float Clearance = -1.0f;
+
+	/** 레지를 등록한 액터 (데이터베이스 레지는 없음) */
+	TWeakObjectPtr<AActor> Owner;
+};
+
+/**
+ * 월드의 올라갈 수 있는 레지 모서리를 균일 격자 공간 해시로 보관합니다.
+ * "앞에 있는 가장 가까운 레지" 조회가 물리 트레이스 + 액터 태그 검사 대신 격자 몇 칸의 조회가 됩니다.
+ * 레지는 UClimbableComponent 또는 구워진 스트리밍 셀의 AGameplayCellData 가 BeginPlay / EndPlay 에서 등록 / 해제합니다.
+ * 맵의 정적 지오메트리 레지는 쿠킹 전에 추출한 FLedgeDatabase (메모리 매핑) 에서 함께 조회합니다.
+ */
+UCLASS(config = Game)
+class TESTPROJECT2_API UClimbableSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** 레지 묶음을 등록하고 해제용 핸들을 반환 */
+	int32 RegisterLedges(AActor* Owner, TConstArrayView<FClimbableLedge> InLedges);
+
+	/** RegisterLedges 로 등록한 묶음을 해제 */
+	void UnregisterLedges(int32 Handle);
+
+	/**
+	 * 발 위치 앞쪽 Reach 거리 안에서 높이가 [MinHeight, MaxHeight] 인 가장 가까운 레지를 찾습니다.
+	 * 게임 스레드 전용입니다.
+	 */
+	bool FindLedgeInFront(const FVector& FeetLocation, const FVector& Forward, float Reach, float MinHeight, float MaxHeight, FClimbableLedgeHit& OutHit) const;
+
+	/** 등록된 레지 수 (데이터베이스 레지 제외) */
+	int32 GetNumLedges() const { return Ledges.Num(); }
+
+	/** 현재 맵의 레지 데이터베이스 (없으면 nullptr) */
+	const FLedgeDatabase* GetLedgeDatabase() const { return LedgeDatabase.Get(); }
+
+	/** 격자 한 칸의 크기 (레지 데이터베이스도 같은 크기로 색인) */
+	float GetCellSize() const { return CellSize; }
+
+	/** 사용 중인 격자 칸 수 */
+	int32 GetNumCells() const { return Cells.Num(); }
+
+	/** 레지스트리 크기, 조회 비용을 출력 */
+	void DumpStats(FOutputDevice& Ar) const;
+
+	/** 레지가 AGameplayCellData 에 구워진 "Climbable" 태그 액터에 붙는 태그 (런타임 태그 등록에서 제외) */
+	static const FName BakedClimbableTag;
+
+	/**
+	 * 프리미티브 단순 충돌의 수평 윗면 모서리를 레지로 생성 (박스 컴포넌트, 메쉬 바디의 박스 / 컨벡스 요소).
+	 * 수평 윗면이 없는 요소 (경사로, 구 / 캡슐 등) 는 레지를 만들지 않음
+	 */
+	static void BuildLedgesFromCollision(const UPrimitiveComponent* Primitive, TArray<FClimbableLedge>& OutLedges);
+
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+protected:
+	/** 격자 한 칸의 크기 (cm) */
+	UPROPERTY(config)
+	float CellSize = 500.0f;
+
+	/** 레지를 향하고 있다고 볼 최소 내적 (전방 · 벽 안쪽 방향) */
+	UPROPERTY(config)
+	float MinFacingDot = 0.5f;
+
+	/** 데이터베이스 레지 위에 필요한 최소 여유 높이 (cm, 캡슐이 올라설 공간) */
+	UPROPERTY(config)
+	float MinLedgeClearance = 0.0f;
+
+private:
+	struct FLedgeEntry
+	{
+		FClimbableLedge Ledge;
+		TWeakObjectPtr<AActor> Owner;
+		/** 한 조회에서 여러 칸에 걸친 레지를 한 번만 검사하기 위한 표식 */
+		mutable uint32 QueryStamp = 0;
+	};
+
+	/** 레지 하나를 조회 조건으로 검사하고, 지금까지보다 가까우면 OutHit 갱신 */
+	bool TestLedge(const FVector& FeetLocation, const FVector& Forward2D, const FVector& Start, const FVector& End, const FVector& OutwardNormal,
+		float MinHeight, float MaxHeight, float& InOutBestDistance, FClimbableLedgeHit& OutHit) const;
+
+	FIntPoint GetCell(const FVector& Location) const;
+	void AddToCells(int32 LedgeIndex);
+	void RemoveFromCells(int32 LedgeIndex);
+
+	/**
+	 * 태그 "Climbable" 만 가진 기존 레벨 액터를 레벨 단위로 등록.
+	 * 시작 시 보이는 레벨을 등록하고, 이후 스트리밍되는 레벨 (월드 파티션 셀 포함) 은 추가 / 제거될 때 등록 / 해제
+	 */
+	void RegisterLegacyTaggedActors(UWorld& InWorld);
+	void RegisterLegacyTaggedActors(ULevel& Level);
+	void OnLevelAddedToWorld(ULevel* Level, UWorld* World);
+	void OnLevelRemovedFromWorld(ULevel* Level, UWorld* World);
+
+	TSparseArray<FLedgeEntry> Ledges;
+	TSparseArray<TArray<int32>> Groups;
+	TMap<FIntPoint, TArray<int32>> Cells;
+
+	/** 레벨별 태그 액터 레지 묶음 핸들 */
+	TMap<TObjectKey<ULevel>, TArray<int32>> LegacyGroupsByLevel;
+	FDelegateHandle LevelAddedHandle;
+	FDelegateHandle LevelRemovedHandle;
+
+	/** 맵의 정적 레지 (읽기 전용 매핑) */
+	TUniquePtr<FLedgeDatabase> LedgeDatabase;
+
+	mutable uint32 QueryStampCounter = 0;
+
+	/** 조회 비용 집계 */
+	mutable uint64 NumQueries = 0;
+	mutable uint64 TotalQueryCycles = 0;
+	mutable uint64 TotalCandidatesTested = 0;
+	mutable int32 LastQueryCandidates = 0;
+};
@@ -0,0 +1,377 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ClimbingMovementComponent.h"
+#include "ClimbSubsystem.h"
+#include "LedgeQueryComponent.h"
+#include "TestProject2Character.h"
+#include "TestProject2.h"
+#include "GameFramework/Character.h"
+#include "HAL/IConsoleManager.h"
+
+static int32 GClimbBatchEnable = 1;
+static FAutoConsoleVariableRef CVarClimbBatchEnable(
+	TEXT("TestProject2.Climb.Batch"),
+	GClimbBatchEnable,
+	TEXT("예측이 필요 없는 올라가기를 UClimbSubsystem 에서 한 번에 갱신합니다. 0 이면 캐릭터마다 PhysCustom 에서 진행합니다."));
+
+//////////////////////////////////////////////////////////////////////////
+// FClimbNetworkMoveData
+
+void FClimbNetworkMoveData::ClientFillNetworkMoveData(const FSavedMove_Character& ClientMove, ENetworkMoveType MoveType)
+{
+	FCharacterNetworkMoveData::ClientFillNetworkMoveData(ClientMove, MoveType);
+
+	const FSavedMove_Climb& ClimbMove = static_cast<const FSavedMove_Climb&>(ClientMove);
+	ClimbTargetLocation = ClimbMove.SavedClimbTargetLocation;
+}
+
+bool FClimbNetworkMoveData::Serialize(UCharacterMovementComponent& CharacterMovement, FArchive& Ar, UPackageMap* PackageMap, ENetworkMoveType MoveType)
+{
+	bool bSuccess = FCharacterNetworkMoveData::Serialize(CharacterMovement, Ar, PackageMap, MoveType);
+
+	// 올라가기를 요청한 이동에만 목표 위치를 싣는다 (나머지 이동은 추가 비트 없음)
+	if (CompressedMoveFlags & FSavedMove_Character::FLAG_Custom_0)
+	{
+		bool bLocalSuccess = true;
+		ClimbTargetLocation.NetSerialize(Ar, PackageMap, bLocalSuccess);
+		bSuccess &= bLocalSuccess;
+	}
+
+	return bSuccess && !Ar.IsError();
+}
+
+FClimbNetworkMoveDataContainer::FClimbNetworkMoveDataContainer()
+{
+	NewMoveData = &ClimbMoveData[0];
+	PendingMoveData = &ClimbMoveData[1];
+	OldMoveData = &ClimbMoveData[2];
+}
+
+//////////////////////////////////////////////////////////////////////////
+// FSavedMove_Climb
+
+void FSavedMove_Climb::Clear()
+{
+	Super::Clear();
+
+	bSavedWantsToClimb = false;
+	SavedClimbTargetLocation = FVector::ZeroVector;
+	SavedClimbStartLocation = FVector::ZeroVector;
+	SavedActiveClimbTarget = FVector::ZeroVector;
+	SavedClimbElapsed = 0.0f;
+	SavedClimbDuration = 0.0f;
+}
+
+uint8 FSavedMove_Climb::GetCompressedFlags() const
+{
+	uint8 Result = Super::GetCompressedFlags();
+	if (bSavedWantsToClimb)
+	{
+		Result |= FLAG_Custom_0;
+	}
+	return Result;
+}
+
+bool FSavedMove_Climb::CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const
+{
+	const FSavedMove_Climb* NewClimbMove = static_cast<const FSavedMove_Climb*>(NewMove.Get());
+	if (bSavedWantsToClimb != NewClimbMove->bSavedWantsToClimb)
+	{
+		return false;
+	}
+	return Super::CanCombineWith(NewMove, InCharacter, MaxDelta);
+}
+
+void FSavedMove_Climb::SetMoveFor(ACharacter* C, float InDeltaTime, FVector const& NewAccel, FNetworkPredictionData_Client_Character& ClientData)
+{
+	Super::SetMoveFor(C, InDeltaTime, NewAccel, ClientData);
+
+	if (const UClimbingMovementComponent* Movement = Cast<UClimbingMovementComponent>(C->GetCharacterMovement()))
+	{
+		bSavedWantsToClimb = Movement->bWantsToClimb;
+		SavedClimbTargetLocation = Movement->RequestedClimbTarget;
+		SavedClimbStartLocation = Movement->ClimbStartLocation;
+		SavedActiveClimbTarget = Movement->ClimbTargetLocation;
+		SavedClimbElapsed = Movement->ClimbElapsed;
+		SavedClimbDuration = Movement->ClimbDuration;
+	}
+}
+
+void FSavedMove_Climb::PrepMoveFor(ACharacter* C)
+{
+	Super::PrepMoveFor(C);
+
+	if (UClimbingMovementComponent* Movement = Cast<UClimbingMovementComponent>(C->GetCharacterMovement()))
+	{
+		Movement->bWantsToClimb = bSavedWantsToClimb;
+		Movement->RequestedClimbTarget = SavedClimbTargetLocation;
+		Movement->ClimbStartLocation = SavedClimbStartLocation;
+		Movement->ClimbTargetLocation = SavedActiveClimbTarget;
+		Movement->ClimbElapsed = SavedClimbElapsed;
+		Movement->ClimbDuration = SavedClimbDuration;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+// FNetworkPredictionData_Client_Climb
+
+FNetworkPredictionData_Client_Climb::FNetworkPredictionData_Client_Climb(const UCharacterMovementComponent& ClientMovement)
+	: Super(ClientMovement)
+{
+}
+
+FSavedMovePtr FNetworkPredictionData_Client_Climb::AllocateNewMove()
+{
+	return FSavedMovePtr(new FSavedMove_Climb());
+}
+
+//////////////////////////////////////////////////////////////////////////
+// UClimbingMovementComponent
+
+UClimbingMovementComponent::UClimbingMovementComponent()
+{
+	SetNetworkMoveDataContainer(ClimbMoveDataContainer);
+
+	MaxClimbTargetDistance = 400.0f;
+	ClimbTargetTolerance = 30.0f;
+
+	bWantsToClimb = false;
+	RequestedClimbTarget = FVector::ZeroVector;
+	ClimbStartLocation = FVector::ZeroVector;
+	ClimbTargetLocation = FVector::ZeroVector;
+	ClimbElapsed = 0.0f;
+	ClimbDuration = 0.0f;
+	ClimbBatchIndex = INDEX_NONE;
+	bRestoreComponentTickAfterClimb = false;
+	bRestoreActorTickAfterClimb = false;
+}
+
+void UClimbingMovementComponent::RequestClimb(const FVector& TargetLocation)
+{
+	bWantsToClimb = true;
+	RequestedClimbTarget = TargetLocation;
+}
+
+void UClimbingMovementComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// 매 프레임 UCurveFloat 를 평가하지 않도록 시작 시 한 번 구운 테이블을 받아둠 (커브가 아직 로드 전이면 선형, 로드 후 교체)
+	const ATestProject2Character* ClimbingCharacter = Cast<ATestProject2Character>(CharacterOwner);
+	SetClimbZOffsetCurve(ClimbingCharacter ? ClimbingCharacter->GetClimbZOffsetCurve() : nullptr);
+}
+
+void UClimbingMovementComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UClimbSubsystem* Climbs = UWorld::GetSubsystem<UClimbSubsystem>(GetWorld()))
+	{
+		Climbs->RemoveClimb(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UClimbingMovementComponent::SetClimbZOffsetCurve(const UCurveFloat* Curve)
+{
+	ClimbZOffsetTable = FClimbCurveCache::FindOrBake(Curve);
+}
+
+bool UClimbingMovementComponent::IsClimbing() const
+{
+	return MovementMode == MOVE_Custom && CustomMovementMode == CMOVE_Climb;
+}
+
+float UClimbingMovementComponent::GetClimbProgress() const
+{
+	return ClimbDuration > UE_KINDA_SMALL_NUMBER ? ClimbElapsed / ClimbDuration : 0.0f;
+}
+
+void UClimbingMovementComponent::UpdateFromCompressedFlags(uint8 Flags)
+{
+	Super::UpdateFromCompressedFlags(Flags);
+
+	bWantsToClimb = (Flags & FSavedMove_Character::FLAG_Custom_0) != 0;
+
+	// 서버: 클라이언트가 보낸 목표 위치를 이동 패킷에서 읽음 (클라이언트 재실행 시에는 PrepMoveFor 가 복원)
+	if (bWantsToClimb && CharacterOwner && CharacterOwner->GetLocalRole() == ROLE_Authority)
+	{
+		if (const FClimbNetworkMoveData* MoveData = static_cast<const FClimbNetworkMoveData*>(GetCurrentNetworkMoveData()))
+		{
+			RequestedClimbTarget = MoveData->ClimbTargetLocation;
+		}
+	}
+}
+
+FNetworkPredictionData_Client* UClimbingMovementComponent::GetPredictionData_Client() const
+{
+	if (ClientPredictionData == nullptr)
+	{
+		UClimbingMovementComponent* MutableThis = const_cast<UClimbingMovementComponent*>(this);
+		MutableThis->ClientPredictionData = new FNetworkPredictionData_Client_Climb(*this);
+	}
+	return ClientPredictionData;
+}
+
+void UClimbingMovementComponent::UpdateCharacterStateBeforeMovement(float DeltaSeconds)
+{
+	if (bWantsToClimb && CanStartClimb())
+	{
+		StartClimb();
+	}
+	bWantsToClimb = false;
+
+	Super::UpdateCharacterStateBeforeMovement(DeltaSeconds);
+}
+
+void UClimbingMovementComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	// 메시 틱(애니메이션 업데이트)은 이동 틱 이후에 실행되므로 여기서 공개한 상태를 같은 프레임에 읽음
+	if (ATestProject2Character* ClimbingCharacter = Cast<ATestProject2Character>(CharacterOwner))
+	{
+		ClimbingCharacter->PublishAnimState();
+	}
+}
+
+bool UClimbingMovementComponent::CanStartClimb() const
+{
+	if (IsClimbing() || UpdatedComponent == nullptr || !(IsMovingOnGround() || IsFalling()))
+	{
+		return false;
+	}
+
+	// 서버에서 비정상적으로 먼 목표는 거부
+	if (FVector::DistSquared(UpdatedComponent->GetComponentLocation(), RequestedClimbTarget) > FMath::Square(MaxClimbTargetDistance))
+	{
+		return false;
+	}
+
+	// 원격 클라이언트의 목표는 스윕 없이 이동하므로 서버의 레지 레지스트리와 대조 (벽 너머 임의 위치로의 순간이동 방지)
+	if (CharacterOwner && CharacterOwner->GetLocalRole() == ROLE_Authority && !CharacterOwner->IsLocallyControlled())
+	{
+		const ATestProject2Character* ClimbingCharacter = Cast<ATestProject2Character>(CharacterOwner);
+		const ULedgeQueryComponent* LedgeQuery = ClimbingCharacter ? ClimbingCharacter->GetLedgeQuery() : nullptr;
+		return LedgeQuery && LedgeQuery->IsValidMantleTarget(RequestedClimbTarget, ClimbTargetTolerance);
+	}
+	return true;
+}
+
+void UClimbingMovementComponent::StartClimb()
+{
+	const ATestProject2Character* ClimbingCharacter = Cast<ATestProject2Character>(CharacterOwner);
+
+	ClimbStartLocation = UpdatedComponent->GetComponentLocation();
+	ClimbTargetLocation = RequestedClimbTarget;
+	ClimbElapsed = 0.0f;
+	ClimbDuration = ClimbingCharacter ? ClimbingCharacter->GetClimbDuration() : 1.0f;
+
+	Velocity = FVector::ZeroVector;
+	SetMovementMode(MOVE_Custom, CMOVE_Climb);
+
+	if (ShouldBatchClimb())
+	{
+		if (UClimbSubsystem* Climbs = UWorld::GetSubsystem<UClimbSubsystem>(GetWorld()))
+		{
+			Climbs->AddClimb(this, ClimbStartLocation, ClimbTargetLocation, ClimbDuration, ClimbZOffsetTable);
+		}
+	}
+}
+
+bool UClimbingMovementComponent::ShouldBatchClimb() const
+{
+	// 원격 클라이언트가 조종하는 캐릭터 (서버 측) 와 자율 프록시는 이동 예측 / 재실행과 맞아야 하므로 PhysCustom 에서 진행
+	return GClimbBatchEnable != 0
+		&& CharacterOwner
+		&& CharacterOwner->GetLocalRole() == ROLE_Authority
+		&& (CharacterOwner->IsLocallyControlled() || CharacterOwner->GetRemoteRole() != ROLE_AutonomousProxy);
+}
+
+void UClimbingMovementComponent::OnMovementModeChanged(EMovementMode PreviousMovementMode, uint8 PreviousCustomMode)
+{
+	// 올라가기가 끝났거나 다른 모드 (발사 등) 로 끊겼으면 묶음에서 빼고 틱 복원
+	if (ClimbBatchIndex != INDEX_NONE && !IsClimbing())
+	{
+		if (UClimbSubsystem* Climbs = UWorld::GetSubsystem<UClimbSubsystem>(GetWorld()))
+		{
+			Climbs->RemoveClimb(this);
+		}
+	}
+
+	Super::OnMovementModeChanged(PreviousMovementMode, PreviousCustomMode);
+}
+
+void UClimbingMovementComponent::PhysCustom(float deltaTime, int32 Iterations)
+{
+	// 묶음으로 진행 중인 올라가기는 UClimbSubsystem 이 위치를 갱신
+	if (CustomMovementMode == CMOVE_Climb && ClimbBatchIndex == INDEX_NONE)
+	{
+		PhysClimb(deltaTime, Iterations);
+	}
+
+	Super::PhysCustom(deltaTime, Iterations);
+}
+
+void UClimbingMovementComponent::PhysClimb(float DeltaTime, int32 Iterations)
+{
+	TP2_SCOPE_CYCLE_COUNTER(STAT_TP2_PhysClimb);
+
+	if (DeltaTime < MIN_TICK_TIME)
+	{
+		return;
+	}
+
+	ClimbElapsed = FMath::Min(ClimbElapsed + DeltaTime, ClimbDuration);
+	const float Alpha = ClimbDuration > UE_KINDA_SMALL_NUMBER ? ClimbElapsed / ClimbDuration : 1.0f;
+	const FVector Delta = EvaluateClimbLocation(Alpha) - UpdatedComponent->GetComponentLocation();
+
+	// 레지 모서리를 넘어가야 하므로 스윕 없이 이동 (물리 바디 텔레포트는 하지 않음)
+	FHitResult Hit;
+	MoveUpdatedComponent(Delta, UpdatedComponent->GetComponentQuat(), false, &Hit, ETeleportType::None);
+	Velocity = Delta / DeltaTime;
+
+	if (Alpha >= 1.0f)
+	{
+		Velocity = FVector::ZeroVector;
+		SetMovementMode(MOVE_Walking);
+	}
+}
+
+void UClimbingMovementComponent::ApplyBatchedClimb(const FVector& NewLocation, float NewElapsed, float DeltaTime)
+{
+	if (UpdatedComponent == nullptr)
+	{
+		return;
+	}
+
+	ClimbElapsed = NewElapsed;
+
+	// PhysClimb 과 같이 스윕 없이 이동
+	const FVector Delta = NewLocation - UpdatedComponent->GetComponentLocation();
+	FHitResult Hit;
+	MoveUpdatedComponent(Delta, UpdatedComponent->GetComponentQuat(), false, &Hit, ETeleportType::None);
+	Velocity = DeltaTime > UE_KINDA_SMALL_NUMBER ? Delta / DeltaTime : FVector::ZeroVector;
+
+	if (ClimbElapsed >= ClimbDuration)
+	{
+		Velocity = FVector::ZeroVector;
+		SetMovementMode(MOVE_Walking);
+	}
+
+	// 올라가는 동안 이 컴포넌트는 틱하지 않으므로 애니메이션 상태를 여기서 공개
+	if (ATestProject2Character* ClimbingCharacter = Cast<ATestProject2Character>(CharacterOwner))
+	{
+		ClimbingCharacter->PublishAnimState();
+	}
+}
+
+FVector UClimbingMovementComponent::EvaluateClimbLocation(float Alpha) const
+{
+	const float ZAlpha = ClimbZOffsetTable.IsValid() ? ClimbZOffsetTable->Evaluate(Alpha) : Alpha;
+
+	return FVector(
+		FMath::Lerp(ClimbStartLocation.X, ClimbTargetLocation.X, Alpha),
+		FMath::Lerp(ClimbStartLocation.Y, ClimbTargetLocation.Y, Alpha),
+		FMath::Lerp(ClimbStartLocation.Z, ClimbTargetLocation.Z, ZAlpha) // Z축은 커브를 통해 계산
+	);
+}
@@ -0,0 +1,157 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "ClimbCurveCache.h"
+#include "ClimbingMovementComponent.generated.h"
+
+/** MOVE_Custom 안에서 사용하는 커스텀 이동 모드 */
+UENUM(BlueprintType)
+enum ECustomMovementMode
+{
+	CMOVE_None UMETA(Hidden),
+	CMOVE_Climb UMETA(DisplayName = "Climb"),
+	CMOVE_MAX UMETA(Hidden),
+};
+
+/** 클라이언트 이동 패킷에 실어 보내는 올라가기 목표 위치 (올라가기 요청 플래그가 있을 때만 직렬화) */
+struct FClimbNetworkMoveData : public FCharacterNetworkMoveData
+{
+	FVector_NetQuantize10 ClimbTargetLocation;
+
+	virtual void ClientFillNetworkMoveData(const FSavedMove_Character& ClientMove, ENetworkMoveType MoveType) override;
+	virtual bool Serialize(UCharacterMovementComponent& CharacterMovement, FArchive& Ar, UPackageMap* PackageMap, ENetworkMoveType MoveType) override;
+};
+
+struct FClimbNetworkMoveDataContainer : public FCharacterNetworkMoveDataContainer
+{
+	FClimbNetworkMoveDataContainer();
+
+	FClimbNetworkMoveData ClimbMoveData[3];
+};
+
+/** 올라가기 요청과 진행 상태를 저장하는 클라이언트 예측용 이동 기록 */
+class FSavedMove_Climb : public FSavedMove_Character
+{
+	using Super = FSavedMove_Character;
+
+public:
+	virtual void Clear() override;
+	virtual uint8 GetCompressedFlags() const override;
+	virtual bool CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const override;
+	virtual void SetMoveFor(ACharacter* C, float InDeltaTime, FVector const& NewAccel, FNetworkPredictionData_Client_Character& ClientData) override;
+	virtual void PrepMoveFor(ACharacter* C) override;
+
+	bool bSavedWantsToClimb = false;
+	FVector SavedClimbTargetLocation = FVector::ZeroVector;
+
+	// 보정 후 재실행 시 복원할 올라가기 진행 상태
+	FVector SavedClimbStartLocation = FVector::ZeroVector;
+	FVector SavedActiveClimbTarget = FVector::ZeroVector;
+	float SavedClimbElapsed = 0.0f;
+	float SavedClimbDuration = 0.0f;
+};
+
+class FNetworkPredictionData_Client_Climb : public FNetworkPredictionData_Client_Character
+{
+	using Super = FNetworkPredictionData_Client_Character;
+
+public:
+	FNetworkPredictionData_Client_Climb(const UCharacterMovementComponent& ClientMovement);
+
+	virtual FSavedMovePtr AllocateNewMove() override;
+};
+
+/**
+ * MOVE_Custom / CMOVE_Climb 모드로 올라가기를 처리하는 캐릭터 이동 컴포넌트.
+ * 올라가기 요청은 압축 플래그 + 양자화된 목표 위치로 서버에 전달되고, 이동은 PhysCustom 안에서
+ * 예측 / 재실행되므로 매 프레임 텔레포트 없이 클라이언트 예측과 복제가 동작합니다.
+ */
+UCLASS()
+class TESTPROJECT2_API UClimbingMovementComponent : public UCharacterMovementComponent
+{
+	GENERATED_BODY()
+
+	friend class FSavedMove_Climb;
+	friend class UClimbSubsystem;
+
+public:
+	UClimbingMovementComponent();
+
+	/** 로컬에서 찾은 레지 목표 위치로 올라가기를 요청 (다음 이동에서 시작되며 서버에 함께 전달됨) */
+	void RequestClimb(const FVector& TargetLocation);
+
+	/** 현재 올라가기 모드인지 */
+	UFUNCTION(BlueprintPure, Category = "Climbing")
+	bool IsClimbing() const;
+
+	/** 현재 올라가기 진행률 (0.0 ~ 1.0) */
+	UFUNCTION(BlueprintPure, Category = "Climbing")
+	float GetClimbProgress() const;
+
+	/** Z 오프셋 커브 교체 (커브가 비동기 로드된 뒤 호출, nullptr 이면 선형) */
+	void SetClimbZOffsetCurve(const UCurveFloat* Curve);
+
+	/** 현재 올라가기 목표 위치 */
+	const FVector& GetClimbTargetLocation() const { return ClimbTargetLocation; }
+
+	/** 현재 올라가기를 UClimbSubsystem 이 묶음으로 진행 중인지 (이 동안 이 컴포넌트는 틱하지 않음) */
+	bool IsClimbBatched() const { return ClimbBatchIndex != INDEX_NONE; }
+
+	virtual void UpdateFromCompressedFlags(uint8 Flags) override;
+	virtual FNetworkPredictionData_Client* GetPredictionData_Client() const override;
+	virtual void UpdateCharacterStateBeforeMovement(float DeltaSeconds) override;
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void PhysCustom(float deltaTime, int32 Iterations) override;
+	virtual void OnMovementModeChanged(EMovementMode PreviousMovementMode, uint8 PreviousCustomMode) override;
+
+	/** 올라가기 목표와 현재 위치 사이의 최대 허용 거리 (서버 검증용) */
+	UPROPERTY(EditDefaultsOnly, Category = "Climbing")
+	float MaxClimbTargetDistance;
+
+	/** 원격 클라이언트가 보낸 목표와 서버가 레지 레지스트리로 계산한 목표의 허용 오차 (cm, 조회 후 이동 / 양자화 오차) */
+	UPROPERTY(EditDefaultsOnly, Category = "Climbing")
+	float ClimbTargetTolerance;
+
+private:
+	bool CanStartClimb() const;
+	void StartClimb();
+	void PhysClimb(float DeltaTime, int32 Iterations);
+
+	/** 이동 예측 / 재실행이 필요 없는 올라가기 (서버 AI, 리슨 서버 호스트, 스탠드얼론) 인지 */
+	bool ShouldBatchClimb() const;
+
+	/** UClimbSubsystem 이 계산한 위치를 적용하고, 끝났으면 걷기로 전환 */
+	void ApplyBatchedClimb(const FVector& NewLocation, float NewElapsed, float DeltaTime);
+
+	/** 진행률 Alpha 에서의 캡슐 위치 */
+	FVector EvaluateClimbLocation(float Alpha) const;
+
+	FClimbNetworkMoveDataContainer ClimbMoveDataContainer;
+
+	/** 소유 캐릭터의 Z 오프셋 커브를 구운 테이블 (같은 커브를 쓰는 캐릭터끼리 공유) */
+	TSharedPtr<const FBakedCurve> ClimbZOffsetTable;
+
+	/** 올라가기 요청 (한 번의 이동에만 실리는 입력) */
+	bool bWantsToClimb;
+	FVector RequestedClimbTarget;
+
+	/** 진행 중인 올라가기 상태 */
+	FVector ClimbStartLocation;
+	FVector ClimbTargetLocation;
+	float ClimbElapsed;
+	float ClimbDuration;
+
+	/** UClimbSubsystem 배열 안의 인덱스 (묶음으로 진행 중이 아니면 INDEX_NONE) */
+	int32 ClimbBatchIndex;
+
+	/** 묶음 등록 때 컴포넌트 / 액터 틱을 껐으면 해제할 때 다시 켬 */
+	bool bRestoreComponentTickAfterClimb;
+	bool bRestoreActorTickAfterClimb;
+};
@@ -0,0 +1,258 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "EffectPoolSubsystem.h"
+#include "TestProject2.h"
+#include "Components/AudioComponent.h"
+#include "Engine/AssetManager.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "NiagaraComponent.h"
+#include "NiagaraSystem.h"
+#include "Sound/SoundBase.h"
+
+static FAutoConsoleCommandWithWorld CmdEffectPoolDump(
+	TEXT("TestProject2.EffectPool.Dump"),
+	TEXT("이펙트 풀 종류별 크기 / 적중 / 부족 / 컬링 / 최대 사용량을 출력합니다."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (const UEffectPoolSubsystem* Subsystem = UWorld::GetSubsystem<UEffectPoolSubsystem>(World))
+		{
+			Subsystem->DumpStats();
+		}
+	}));
+
+bool UEffectPoolSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	return Super::ShouldCreateSubsystem(Outer) && !IsRunningDedicatedServer();
+}
+
+bool UEffectPoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UEffectPoolSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	Pools.SetNum(static_cast<int32>(EPooledEffect::Num));
+
+	TArray<FSoftObjectPath> Assets;
+	for (const FPooledEffectSettings& Settings : Effects)
+	{
+		for (const FSoftObjectPath& Path : { Settings.Niagara.ToSoftObjectPath(), Settings.Sound.ToSoftObjectPath() })
+		{
+			if (!Path.IsNull())
+			{
+				Assets.AddUnique(Path);
+			}
+		}
+	}
+
+	// 로드가 끝나기 전 재생 요청은 부족으로 집계
+	if (Assets.Num() > 0)
+	{
+		LoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(Assets, FStreamableDelegate::CreateUObject(this, &UEffectPoolSubsystem::OnEffectsLoaded));
+	}
+}
+
+void UEffectPoolSubsystem::OnEffectsLoaded()
+{
+	UWorld* World = GetWorld();
+	if (World == nullptr || World->bIsTearingDown)
+	{
+		return;
+	}
+
+	for (const FPooledEffectSettings& Settings : Effects)
+	{
+		if (Settings.Effect >= EPooledEffect::Num || Settings.PoolSize <= 0)
+		{
+			continue;
+		}
+
+		FEffectPool& Pool = Pools[static_cast<int32>(Settings.Effect)];
+		Pool.CullDistanceSquared = FMath::Square(Settings.CullDistance);
+
+		if (UNiagaraSystem* System = Settings.Niagara.Get())
+		{
+			for (int32 Index = 0; Index < Settings.PoolSize; ++Index)
+			{
+				UNiagaraComponent* Component = NewObject<UNiagaraComponent>(World);
+				Component->SetAutoActivate(false);
+				Component->SetAutoDestroy(false);
+				Component->SetAsset(System);
+				Component->RegisterComponentWithWorld(World);
+				Pool.NiagaraComponents.Add(Component);
+				PooledComponents.Add(Component);
+			}
+		}
+
+		if (USoundBase* Sound = Settings.Sound.Get())
+		{
+			for (int32 Index = 0; Index < Settings.PoolSize; ++Index)
+			{
+				UAudioComponent* Component = NewObject<UAudioComponent>(World);
+				Component->bAutoActivate = false;
+				Component->bAutoDestroy = false;
+				Component->bAllowSpatialization = true;
+				Component->SetSound(Sound);
+				Component->RegisterComponentWithWorld(World);
+				Pool.AudioComponents.Add(Component);
+				PooledComponents.Add(Component);
+			}
+		}
+	}
+}
+
+void UEffectPoolSubsystem::Deinitialize()
+{
+	if (LoadHandle.IsValid())
+	{
+		LoadHandle->CancelHandle();
+		LoadHandle.Reset();
+	}
+
+	for (USceneComponent* Component : PooledComponents)
+	{
+		if (Component)
+		{
+			Component->DestroyComponent();
+		}
+	}
+	PooledComponents.Empty();
+	Pools.Empty();
+
+	Super::Deinitialize();
+}
+
+template <typename ComponentType, typename BusyPredicate>
+ComponentType* UEffectPoolSubsystem::Acquire(TArray<ComponentType*>& Components, int32& Next, bool& bOutHit, int32& OutInUse, BusyPredicate IsBusy)
+{
+	const int32 Num = Components.Num();
+	if (Num == 0)
+	{
+		return nullptr;
+	}
+
+	// Next 부터 순서대로 돌며 쉬고 있는 첫 컴포넌트를 사용 (풀이 작으므로 전체를 세어 사용량도 함께 구함)
+	int32 Found = INDEX_NONE;
+	int32 InUse = 0;
+	for (int32 Offset = 0; Offset < Num; ++Offset)
+	{
+		const int32 Index = (Next + Offset) % Num;
+		if (IsBusy(Components[Index]))
+		{
+			++InUse;
+		}
+		else if (Found == INDEX_NONE)
+		{
+			Found = Index;
+		}
+	}
+
+	bOutHit = Found != INDEX_NONE;
+	const int32 Chosen = bOutHit ? Found : Next;
+	OutInUse = bOutHit ? InUse + 1 : Num;
+	Next = (Chosen + 1) % Num;
+	return Components[Chosen];
+}
+
+bool UEffectPoolSubsystem::IsWithinCullDistance(const FEffectPool& Pool, const FVector& Location) const
+{
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PlayerController = It->Get();
+		if (PlayerController && PlayerController->IsLocalController())
+		{
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+			if (FVector::DistSquared(ViewLocation, Location) <= Pool.CullDistanceSquared)
+			{
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+bool UEffectPoolSubsystem::PlayEffect(EPooledEffect Effect, const FVector& Location, const FRotator& Rotation)
+{
+	TP2_SCOPE_CYCLE_COUNTER(STAT_TP2_EffectPoolPlay);
+
+	if (!Pools.IsValidIndex(static_cast<int32>(Effect)))
+	{
+		return false;
+	}
+
+	FEffectPool& Pool = Pools[static_cast<int32>(Effect)];
+	if (Pool.NiagaraComponents.Num() == 0 && Pool.AudioComponents.Num() == 0)
+	{
+		// 설정되지 않았거나 아직 로드 전
+		return false;
+	}
+
+	if (!IsWithinCullDistance(Pool, Location))
+	{
+		++Pool.Culled;
+		INC_DWORD_STAT(STAT_TP2_EffectPoolCulled);
+		return false;
+	}
+
+	bool bHit = true;
+	int32 InUse = 0;
+
+	bool bNiagaraHit = false;
+	int32 NiagaraInUse = 0;
+	if (UNiagaraComponent* Component = Acquire(Pool.NiagaraComponents, Pool.NextNiagara, bNiagaraHit, NiagaraInUse, [](const UNiagaraComponent* Candidate) { return Candidate->IsActive(); }))
+	{
+		Component->SetWorldLocationAndRotation(Location, Rotation);
+		Component->ActivateSystem(true);
+		bHit &= bNiagaraHit;
+		InUse = FMath::Max(InUse, NiagaraInUse);
+	}
+
+	bool bAudioHit = false;
+	int32 AudioInUse = 0;
+	if (UAudioComponent* Component = Acquire(Pool.AudioComponents, Pool.NextAudio, bAudioHit, AudioInUse, [](const UAudioComponent* Candidate) { return Candidate->IsPlaying(); }))
+	{
+		Component->SetWorldLocationAndRotation(Location, Rotation);
+		Component->Play();
+		bHit &= bAudioHit;
+		InUse = FMath::Max(InUse, AudioInUse);
+	}
+
+	if (bHit)
+	{
+		++Pool.Hits;
+		INC_DWORD_STAT(STAT_TP2_EffectPoolHits);
+		CSV_CUSTOM_STAT(TestProject2, EffectPoolHits, 1, ECsvCustomStatOp::Accumulate);
+	}
+	else
+	{
+		// 모두 재생 중이어서 가장 오래된 인스턴스를 끊고 다시 사용
+		++Pool.Misses;
+		INC_DWORD_STAT(STAT_TP2_EffectPoolMisses);
+		CSV_CUSTOM_STAT(TestProject2, EffectPoolMisses, 1, ECsvCustomStatOp::Accumulate);
+	}
+
+	if (InUse > Pool.PeakInUse)
+	{
+		INC_DWORD_STAT_BY(STAT_TP2_EffectPoolPeakInUse, InUse - Pool.PeakInUse);
+		Pool.PeakInUse = InUse;
+	}
+	return true;
+}
+
+void UEffectPoolSubsystem::DumpStats() const
+{
+	const UEnum* EffectEnum = StaticEnum<EPooledEffect>();
+	for (int32 Index = 0; Index < Pools.Num(); ++Index)
+	{
+		const FEffectPool& Pool = Pools[Index];
+		UE_LOG(LogTestProject2, Display, TEXT("Effect pool %-16s: %d niagara / %d audio, %d hits, %d misses, %d culled, peak %d"),
+			*EffectEnum->GetNameStringByIndex(Index), Pool.NiagaraComponents.Num(), Pool.AudioComponents.Num(), Pool.Hits, Pool.Misses, Pool.Culled, Pool.PeakInUse);
+	}
+}
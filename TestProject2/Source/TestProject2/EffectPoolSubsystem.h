@@ -0,0 +1,118 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EffectPoolSubsystem.generated.h"
+
+class UAudioComponent;
+class UNiagaraComponent;
+class UNiagaraSystem;
+class USceneComponent;
+class USoundBase;
+struct FStreamableHandle;
+
+/** 풀에서 재생하는 게임플레이 피드백 종류 */
+UENUM()
+enum class EPooledEffect : uint8
+{
+	JumpPadLaunch,
+	JumpPadLanding,
+	ClimbStart,
+	SlowMotionEnter,
+	SlowMotionExit,
+	Num UMETA(Hidden)
+};
+
+/** 효과 종류 하나의 설정 (DefaultGame.ini) */
+USTRUCT()
+struct FPooledEffectSettings
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, Category = "Effect")
+	EPooledEffect Effect = EPooledEffect::JumpPadLaunch;
+
+	/** 비어 있으면 소리만 재생 */
+	UPROPERTY(EditAnywhere, Category = "Effect")
+	TSoftObjectPtr<UNiagaraSystem> Niagara;
+
+	/** 비어 있으면 이펙트만 재생 */
+	UPROPERTY(EditAnywhere, Category = "Effect")
+	TSoftObjectPtr<USoundBase> Sound;
+
+	/** 미리 만들어 두는 나이아가라 / 오디오 컴포넌트 수 (동시 재생 상한). 모두 재생 중이면 가장 오래된 것을 다시 사용 */
+	UPROPERTY(EditAnywhere, Category = "Effect")
+	int32 PoolSize = 4;
+
+	/** 모든 로컬 뷰포인트에서 이 거리 밖이면 재생하지 않음 */
+	UPROPERTY(EditAnywhere, Category = "Effect")
+	float CullDistance = 5000.0f;
+};
+
+/**
+ * 점프대 발사 / 착지, 올라가기 시작, 슬로우 모션 진입 / 해제 피드백을 미리 만들어 둔 나이아가라 / 오디오 컴포넌트로 재생합니다.
+ * 월드 시작 시 에셋을 비동기로 로드하여 종류별 PoolSize 만큼 컴포넌트를 만들고, 재생은 위치를 옮겨 다시 활성화할 뿐
+ * UObject 를 만들지 않습니다. 풀 적중 / 부족 / 컬링 수와 최대 사용량은 stat TestProject2 와 TestProject2.EffectPool.Dump 로 확인합니다.
+ * 데디케이티드 서버에서는 만들어지지 않습니다.
+ */
+UCLASS(config = Game)
+class TESTPROJECT2_API UEffectPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Effect 를 Location 에 재생. 컬링되었거나 아직 로드 전이면 false */
+	bool PlayEffect(EPooledEffect Effect, const FVector& Location, const FRotator& Rotation = FRotator::ZeroRotator);
+
+	/** 종류별 풀 사용 통계를 로그로 출력 */
+	void DumpStats() const;
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	UPROPERTY(config)
+	TArray<FPooledEffectSettings> Effects;
+
+private:
+	struct FEffectPool
+	{
+		/** 비어 있으면 해당 종류를 재생하지 않음 */
+		TArray<UNiagaraComponent*> NiagaraComponents;
+		TArray<UAudioComponent*> AudioComponents;
+
+		/** 다음에 확인할 컴포넌트 (순서대로 돌기 때문에 모두 사용 중이면 가장 오래된 것) */
+		int32 NextNiagara = 0;
+		int32 NextAudio = 0;
+
+		float CullDistanceSquared = 0.0f;
+
+		int32 Hits = 0;
+		int32 Misses = 0;
+		int32 Culled = 0;
+		int32 PeakInUse = 0;
+	};
+
+	void OnEffectsLoaded();
+
+	/** 풀에 쉬고 있는 컴포넌트가 있으면 그것을, 없으면 가장 오래된 것을 반환하고 적중 여부와 사용 중인 수를 기록 */
+	template <typename ComponentType, typename BusyPredicate>
+	static ComponentType* Acquire(TArray<ComponentType*>& Components, int32& Next, bool& bOutHit, int32& OutInUse, BusyPredicate IsBusy);
+
+	/** 로컬 플레이어 뷰포인트 중 하나라도 CullDistance 안인지 */
+	bool IsWithinCullDistance(const FEffectPool& Pool, const FVector& Location) const;
+
+	/** EPooledEffect 순서의 풀 */
+	TArray<FEffectPool> Pools;
+
+	/** 풀 컴포넌트 (GC 참조 유지, 월드에 직접 등록되며 소유 액터 없음) */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<USceneComponent>> PooledComponents;
+
+	TSharedPtr<FStreamableHandle> LoadHandle;
+};
@@ -0,0 +1,278 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GameplayCellData.h"
+#include "TestProject2.h"
+#include "AJumpActor.h"
+#include "ClimbableComponent.h"
+#include "JumpPadSubsystem.h"
+#include "Components/BoxComponent.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
+#if WITH_EDITOR
+#include "WorldPartition/WorldPartition.h"
+#include "WorldPartition/WorldPartitionActorDescInstance.h"
+#include "WorldPartition/WorldPartitionHelpers.h"
+#endif
+
+#if WITH_EDITOR
+static FAutoConsoleCommandWithWorldAndArgs CmdBuildGameplayCellData(
+	TEXT("TestProject2.BuildGameplayCellData"),
+	TEXT("월드의 모든 레지 / 점프대를 스트리밍 셀 단위 AGameplayCellData 로 굽습니다. 인자: [CellSize]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		const float CellSize = Args.Num() > 0 ? FCString::Atof(*Args[0]) : AGameplayCellData::DefaultCellSize;
+		AGameplayCellData::BuildForWorld(World, CellSize > 0.0f ? CellSize : AGameplayCellData::DefaultCellSize);
+	}));
+#endif
+
+AGameplayCellData::AGameplayCellData()
+{
+	PrimaryActorTick.bCanEverTick = false;
+	SetCanBeDamaged(false);
+
+	RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
+	RootComponent->SetMobility(EComponentMobility::Static);
+
+#if WITH_EDITORONLY_DATA
+	// 셀 중심 위치로 런타임 셀이 결정되도록 공간 로딩
+	bIsSpatiallyLoaded = true;
+#endif
+
+	Cell = FIntPoint::ZeroValue;
+	LedgeHandle = INDEX_NONE;
+}
+
+void AGameplayCellData::BeginPlay()
+{
+	Super::BeginPlay();
+
+	UWorld* World = GetWorld();
+
+	if (UClimbableSubsystem* Climbables = World->GetSubsystem<UClimbableSubsystem>())
+	{
+		if (Ledges.Num() > 0)
+		{
+			LedgeHandle = Climbables->RegisterLedges(this, Ledges);
+		}
+	}
+
+	UJumpPadSubsystem* JumpPadSubsystem = World->GetSubsystem<UJumpPadSubsystem>();
+	if (JumpPadSubsystem == nullptr)
+	{
+		return;
+	}
+
+	// 발사 볼륨만 만들어 등록 (메쉬 / 액터는 필요 없음)
+	PadVolumes.Reserve(JumpPads.Num());
+	PadHandles.Reserve(JumpPads.Num());
+	for (const FJumpPadVolumeData& Pad : JumpPads)
+	{
+		UBoxComponent* Volume = NewObject<UBoxComponent>(this, NAME_None, RF_Transient);
+		Volume->SetupAttachment(RootComponent);
+		Volume->SetMobility(EComponentMobility::Static);
+		Volume->SetWorldTransform(Pad.VolumeTransform);
+		Volume->SetBoxExtent(Pad.BoxExtent, false);
+		Volume->SetCollisionProfileName(TEXT("JumpPad"));
+		Volume->SetGenerateOverlapEvents(true);
+		Volume->RegisterComponent();
+
+		PadVolumes.Add(Volume);
+		PadHandles.Add(JumpPadSubsystem->RegisterPad(this, Volume, Pad.LaunchVelocity));
+	}
+}
+
+void AGameplayCellData::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UWorld* World = GetWorld();
+
+	if (UClimbableSubsystem* Climbables = World->GetSubsystem<UClimbableSubsystem>())
+	{
+		if (LedgeHandle != INDEX_NONE)
+		{
+			Climbables->UnregisterLedges(LedgeHandle);
+		}
+	}
+	LedgeHandle = INDEX_NONE;
+
+	if (UJumpPadSubsystem* JumpPadSubsystem = World->GetSubsystem<UJumpPadSubsystem>())
+	{
+		for (int32 Handle : PadHandles)
+		{
+			JumpPadSubsystem->UnregisterPad(Handle);
+		}
+	}
+	PadHandles.Reset();
+
+	for (UBoxComponent* Volume : PadVolumes)
+	{
+		if (Volume)
+		{
+			Volume->DestroyComponent();
+		}
+	}
+	PadVolumes.Reset();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+#if WITH_EDITOR
+void AGameplayCellData::BuildForWorld(UWorld* World, float CellSize)
+{
+	if (World == nullptr || World->IsGameWorld())
+	{
+		return;
+	}
+
+	auto GetCellOf = [CellSize](const FVector& Location)
+	{
+		return FIntPoint(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+	};
+
+	struct FCellBuild
+	{
+		TArray<FClimbableLedge> Ledges;
+		TArray<FJumpPadVolumeData> JumpPads;
+		float SumZ = 0.0f;
+		int32 NumSources = 0;
+	};
+	TMap<FIntPoint, FCellBuild> CellBuilds;
+
+	TArray<AGameplayCellData*> StaleCellData;
+
+	auto VisitActor = [&](AActor* Actor)
+	{
+		if (AGameplayCellData* OldCellData = Cast<AGameplayCellData>(Actor))
+		{
+			StaleCellData.Add(OldCellData);
+			return;
+		}
+
+		const bool bStatic = Actor->GetRootComponent() && Actor->GetRootComponent()->Mobility != EComponentMobility::Movable;
+
+		static const FName ClimbableTag(TEXT("Climbable"));
+		UClimbableComponent* Climbable = Actor->FindComponentByClass<UClimbableComponent>();
+		if (Climbable == nullptr && Actor->Tags.Contains(ClimbableTag))
+		{
+			// 태그만 가진 기존 레벨 액터. 구워진 액터는 표시해 두어 런타임에 UClimbableSubsystem 이 다시 등록하지 않게 함
+			TArray<FClimbableLedge> ActorLedges;
+			if (bStatic)
+			{
+				const UPrimitiveComponent* Primitive = Cast<UPrimitiveComponent>(Actor->GetRootComponent());
+				UClimbableSubsystem::BuildLedgesFromCollision(Primitive ? Primitive : Actor->FindComponentByClass<UPrimitiveComponent>(), ActorLedges);
+			}
+
+			const bool bBaked = ActorLedges.Num() > 0;
+			if (bBaked != Actor->Tags.Contains(UClimbableSubsystem::BakedClimbableTag))
+			{
+				Actor->Modify();
+				if (bBaked)
+				{
+					Actor->Tags.Add(UClimbableSubsystem::BakedClimbableTag);
+				}
+				else
+				{
+					Actor->Tags.Remove(UClimbableSubsystem::BakedClimbableTag);
+				}
+			}
+
+			if (bBaked)
+			{
+				FCellBuild& Build = CellBuilds.FindOrAdd(GetCellOf(Actor->GetActorLocation()));
+				Build.Ledges.Append(ActorLedges);
+				Build.SumZ += Actor->GetActorLocation().Z;
+				++Build.NumSources;
+			}
+		}
+		else if (Climbable)
+		{
+			TArray<FClimbableLedge> ActorLedges;
+			if (bStatic)
+			{
+				Climbable->GatherLedges(ActorLedges);
+			}
+
+			Climbable->Modify();
+			Climbable->SetBakedIntoCellData(ActorLedges.Num() > 0);
+
+			if (ActorLedges.Num() > 0)
+			{
+				FCellBuild& Build = CellBuilds.FindOrAdd(GetCellOf(Actor->GetActorLocation()));
+				Build.Ledges.Append(ActorLedges);
+				Build.SumZ += Actor->GetActorLocation().Z;
+				++Build.NumSources;
+			}
+		}
+
+		if (AJumpActor* JumpPad = Cast<AJumpActor>(Actor))
+		{
+			const UBoxComponent* TriggerBox = JumpPad->GetTriggerBox();
+			JumpPad->Modify();
+			JumpPad->SetBakedIntoCellData(bStatic && TriggerBox != nullptr);
+
+			if (bStatic && TriggerBox)
+			{
+				FCellBuild& Build = CellBuilds.FindOrAdd(GetCellOf(JumpPad->GetActorLocation()));
+				FJumpPadVolumeData& Pad = Build.JumpPads.AddDefaulted_GetRef();
+				Pad.VolumeTransform = TriggerBox->GetComponentTransform();
+				Pad.BoxExtent = TriggerBox->GetUnscaledBoxExtent();
+				Pad.LaunchVelocity = JumpPad->GetLaunchArc().LaunchVelocity;
+				Build.SumZ += JumpPad->GetActorLocation().Z;
+				++Build.NumSources;
+			}
+		}
+	};
+
+	// 월드 파티션에서는 TActorIterator 가 로드된 셀의 액터만 보므로 모든 액터를 로드하며 순회.
+	// 구워짐 표시를 바꾼 원본과 지울 이전 결과가 저장 / 삭제 전에 언로드되지 않도록 참조를 빌드가 끝날 때까지 유지
+	FWorldPartitionHelpers::FForEachActorWithLoadingResult LoadResult;
+	if (UWorldPartition* WorldPartition = World->GetWorldPartition())
+	{
+		FWorldPartitionHelpers::FForEachActorWithLoadingParams LoadParams;
+		LoadParams.bKeepReferences = true;
+		FWorldPartitionHelpers::ForEachActorWithLoading(WorldPartition, [&VisitActor](const FWorldPartitionActorDescInstance* ActorDescInstance)
+		{
+			if (AActor* Actor = ActorDescInstance->GetActor())
+			{
+				VisitActor(Actor);
+			}
+			return true;
+		}, LoadParams, LoadResult);
+	}
+	else
+	{
+		for (TActorIterator<AActor> It(World); It; ++It)
+		{
+			VisitActor(*It);
+		}
+	}
+
+	// 이전 빌드 결과 제거
+	for (AGameplayCellData* OldCellData : StaleCellData)
+	{
+		World->EditorDestroyActor(OldCellData, true);
+	}
+
+	for (TPair<FIntPoint, FCellBuild>& Pair : CellBuilds)
+	{
+		FCellBuild& Build = Pair.Value;
+		const FVector Center((Pair.Key.X + 0.5f) * CellSize, (Pair.Key.Y + 0.5f) * CellSize, Build.SumZ / Build.NumSources);
+
+		FActorSpawnParameters Params;
+		Params.ObjectFlags |= RF_Transactional;
+		AGameplayCellData* CellData = World->SpawnActor<AGameplayCellData>(Center, FRotator::ZeroRotator, Params);
+		if (CellData == nullptr)
+		{
+			continue;
+		}
+
+		CellData->Cell = Pair.Key;
+		CellData->Ledges = MoveTemp(Build.Ledges);
+		CellData->JumpPads = MoveTemp(Build.JumpPads);
+		CellData->SetActorLabel(FString::Printf(TEXT("GameplayCellData_%d_%d"), Pair.Key.X, Pair.Key.Y));
+		CellData->SetFolderPath(TEXT("GameplayCellData"));
+	}
+
+	UE_LOG(LogTestProject2, Log, TEXT("Built %d gameplay cell data actors (cell size %.0f)"), CellBuilds.Num(), CellSize);
+}
+#endif
@@ -0,0 +1,82 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "ClimbableSubsystem.h"
+#include "GameplayCellData.generated.h"
+
+class UBoxComponent;
+
+/** 구워진 점프대 발사 볼륨 하나 */
+USTRUCT()
+struct FJumpPadVolumeData
+{
+	GENERATED_BODY()
+
+	/** 볼륨의 월드 트랜스폼 */
+	UPROPERTY(VisibleAnywhere, Category = "Jump Pad")
+	FTransform VolumeTransform;
+
+	/** 박스 반 크기 (스케일 미적용) */
+	UPROPERTY(VisibleAnywhere, Category = "Jump Pad")
+	FVector BoxExtent = FVector::ZeroVector;
+
+	/** 미리 계산한 발사 속도 */
+	UPROPERTY(VisibleAnywhere, Category = "Jump Pad")
+	FVector LaunchVelocity = FVector::ZeroVector;
+};
+
+/**
+ * 월드 파티션 런타임 셀 하나에 속한 레지 / 점프대 게임플레이 데이터 묶음.
+ * 셀 중심에 배치되어 셀과 함께 스트리밍되며, 로드되면 레지와 발사 볼륨을 한 번에 등록하고 언로드되면 해제합니다.
+ * 따라서 레지스트리 메모리는 월드 크기가 아니라 로드된 셀 수에 비례하고, 레지 / 볼륨 위치를 알기 위해 원본 액터의 컴포넌트를 생성할 필요가 없습니다.
+ * 에디터에서 TestProject2.BuildGameplayCellData 로 생성합니다.
+ */
+UCLASS(NotBlueprintable)
+class TESTPROJECT2_API AGameplayCellData : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	AGameplayCellData();
+
+	/** 셀 크기 기본값 (월드 파티션 기본 런타임 그리드 셀 크기와 같음) */
+	static constexpr float DefaultCellSize = 12800.0f;
+
+#if WITH_EDITOR
+	/**
+	 * World 의 UClimbableComponent / AJumpActor 를 (월드 파티션이면 언로드된 셀의 액터도 로드하여) CellSize 격자로 묶어 셀마다 AGameplayCellData 를 다시 생성하고,
+	 * 원본을 "구워짐" 으로 표시합니다. 움직일 수 있는 (Movable) 액터는 런타임에 직접 등록하도록 남겨둡니다.
+	 */
+	static void BuildForWorld(UWorld* World, float CellSize = DefaultCellSize);
+#endif
+
+	int32 GetNumLedges() const { return Ledges.Num(); }
+	int32 GetNumJumpPads() const { return JumpPads.Num(); }
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/** 셀 좌표 (CellSize 격자) */
+	UPROPERTY(VisibleAnywhere, Category = "Gameplay Cell")
+	FIntPoint Cell;
+
+	/** 레지 모서리 (월드 좌표) */
+	UPROPERTY(VisibleAnywhere, Category = "Gameplay Cell")
+	TArray<FClimbableLedge> Ledges;
+
+	/** 점프대 발사 볼륨 */
+	UPROPERTY(VisibleAnywhere, Category = "Gameplay Cell")
+	TArray<FJumpPadVolumeData> JumpPads;
+
+private:
+	/** 런타임에 만든 발사 볼륨 (JumpPads 와 같은 순서) */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UBoxComponent>> PadVolumes;
+
+	int32 LedgeHandle;
+	TArray<int32> PadHandles;
+};
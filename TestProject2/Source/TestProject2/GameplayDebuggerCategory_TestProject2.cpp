@@ -0,0 +1,167 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GameplayDebuggerCategory_TestProject2.h"
+
+#if WITH_GAMEPLAY_DEBUGGER
+
+#include "TestProject2Character.h"
+#include "AJumpActor.h"
+#include "ClimbingMovementComponent.h"
+#include "LedgeQueryComponent.h"
+#include "ScreenEffectSubsystem.h"
+#include "TimeBubbleSubsystem.h"
+#include "TimeDilationSubsystem.h"
+#include "Animation/AnimInstance.h"
+#include "Animation/AnimMontage.h"
+#include "Components/CapsuleComponent.h"
+#include "EngineUtils.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/WorldSettings.h"
+
+namespace TestProject2Debugger
+{
+	/** 이 거리 안의 점프대만 궤적을 그림 */
+	constexpr float JumpPadDrawDistance = 5000.0f;
+
+	/** 궤적을 나누는 구간 수 */
+	constexpr int32 ArcSegments = 16;
+}
+
+FGameplayDebuggerCategory_TestProject2::FGameplayDebuggerCategory_TestProject2()
+{
+	bShowOnlyWithDebugActor = false;
+}
+
+TSharedRef<FGameplayDebuggerCategory> FGameplayDebuggerCategory_TestProject2::MakeInstance()
+{
+	return MakeShareable(new FGameplayDebuggerCategory_TestProject2());
+}
+
+void FGameplayDebuggerCategory_TestProject2::CollectData(APlayerController* OwnerPC, AActor* DebugActor)
+{
+	const UWorld* World = OwnerPC ? OwnerPC->GetWorld() : nullptr;
+	if (World == nullptr)
+	{
+		return;
+	}
+
+	const ATestProject2Character* Character = Cast<ATestProject2Character>(DebugActor);
+	if (Character == nullptr)
+	{
+		Character = Cast<ATestProject2Character>(OwnerPC->GetPawn());
+	}
+
+	CollectTimeDilation(*World, Character);
+
+	if (Character)
+	{
+		CollectClimbing(*Character);
+	}
+
+	FVector ViewLocation;
+	FRotator ViewRotation;
+	OwnerPC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+	CollectJumpPads(*World, ViewLocation);
+}
+
+void FGameplayDebuggerCategory_TestProject2::CollectTimeDilation(const UWorld& World, const ATestProject2Character* Character)
+{
+	const AWorldSettings* WorldSettings = World.GetWorldSettings();
+	const UTimeDilationSubsystem* TimeDilation = World.GetSubsystem<UTimeDilationSubsystem>();
+	const UScreenEffectSubsystem* ScreenEffects = World.GetSubsystem<UScreenEffectSubsystem>();
+
+	AddTextLine(FString::Printf(TEXT("{white}Global dilation: {yellow}%.3f {white}slow motion weight: {yellow}%.2f"),
+		WorldSettings ? WorldSettings->GetEffectiveTimeDilation() : 1.0f, TimeDilation ? TimeDilation->GetSlowMotionWeight() : 0.0f));
+
+	if (Character)
+	{
+		const UTimeBubbleSubsystem* TimeBubbles = World.GetSubsystem<UTimeBubbleSubsystem>();
+		AddTextLine(FString::Printf(TEXT("{white}Character dilation: {yellow}%.3f {white}(time bubble %.3f)"),
+			Character->CustomTimeDilation, TimeBubbles ? TimeBubbles->GetBubbleDilation(Character) : 1.0f));
+
+		// 흑백화 레이어는 클라이언트에만 있음 (데디케이티드 서버에서 수집하면 표시하지 않음)
+		if (ScreenEffects && ScreenEffects->HasLayer(ATestProject2Character::SlowMotionScreenLayer))
+		{
+			const float Weight = ScreenEffects->GetLayerWeight(ATestProject2Character::SlowMotionScreenLayer);
+			AddTextLine(FString::Printf(TEXT("{white}Saturation: {yellow}%.2f {white}(layer weight %.2f)"),
+				FMath::Lerp(1.0f, Character->GetSlowMotionTargetSaturation(), Weight), Weight));
+		}
+	}
+}
+
+void FGameplayDebuggerCategory_TestProject2::CollectClimbing(const ATestProject2Character& Character)
+{
+	const UClimbingMovementComponent* Movement = Character.GetClimbingMovement();
+	const ULedgeQueryComponent* LedgeQuery = Character.GetLedgeQuery();
+	const UCapsuleComponent* Capsule = Character.GetCapsuleComponent();
+	const float Radius = Capsule->GetScaledCapsuleRadius();
+	const float HalfHeight = Capsule->GetScaledCapsuleHalfHeight();
+
+	if (Movement->IsClimbing())
+	{
+		AddTextLine(FString::Printf(TEXT("{white}Climbing: {green}%.0f%% {grey}(%s)"), Movement->GetClimbProgress() * 100.0f,
+			Movement->IsClimbBatched() ? TEXT("batched") : TEXT("PhysCustom")));
+		AddShape(FGameplayDebuggerShape::MakeCapsule(Movement->GetClimbTargetLocation(), Radius, HalfHeight, FColor::Cyan, TEXT("Climb target")));
+	}
+	else
+	{
+		AddTextLine(TEXT("{white}Climbing: {grey}no"));
+	}
+
+	// 몽타주 진행률 (몽타주 에셋이 아직 상주하지 않아도 올라가기는 같은 시간으로 진행)
+	const UAnimMontage* ClimbMontage = Character.GetClimbMontage();
+	const UAnimInstance* AnimInstance = Character.GetMesh() ? Character.GetMesh()->GetAnimInstance() : nullptr;
+	if (ClimbMontage == nullptr)
+	{
+		AddTextLine(FString::Printf(TEXT("{white}Climb montage: {red}not resident {white}(climb %.2f s)"), Character.GetClimbDuration()));
+	}
+	else if (AnimInstance && AnimInstance->Montage_IsPlaying(ClimbMontage))
+	{
+		AddTextLine(FString::Printf(TEXT("{white}Climb montage: {green}%.2f / %.2f s"), AnimInstance->Montage_GetPosition(ClimbMontage), ClimbMontage->GetPlayLength()));
+	}
+	else
+	{
+		AddTextLine(FString::Printf(TEXT("{white}Climb montage: {grey}idle {white}(%.2f s)"), Character.GetClimbDuration()));
+	}
+
+	// 최근 레지 프로브
+	const FLedgeQueryResult& Ledge = LedgeQuery->GetLatestResult();
+	if (Ledge.IssuedFrame == 0 || Ledge.WallNormal.IsZero())
+	{
+		AddTextLine(TEXT("{white}Ledge: {grey}none"));
+		return;
+	}
+
+	const FColor Color = Ledge.bIsClimbable ? FColor::Green : FColor::Red;
+	AddTextLine(FString::Printf(TEXT("{white}Ledge: %s{white} height %.0f, %llu frames old"),
+		Ledge.bIsClimbable ? TEXT("{green}climbable") : TEXT("{red}blocked"), Ledge.MantleHeight, GFrameCounter - Ledge.IssuedFrame));
+	AddShape(FGameplayDebuggerShape::MakeArrow(Ledge.WallImpactPoint, Ledge.WallImpactPoint + Ledge.WallNormal * 50.0f, 10.0f, 2.0f, Color));
+	AddShape(FGameplayDebuggerShape::MakeCapsule(Ledge.bIsClimbable ? Ledge.MantleTargetLocation : Ledge.LedgeTopPoint + FVector(0.0f, 0.0f, HalfHeight), Radius, HalfHeight, Color));
+}
+
+void FGameplayDebuggerCategory_TestProject2::CollectJumpPads(const UWorld& World, const FVector& ViewLocation)
+{
+	int32 NumPads = 0;
+	for (TActorIterator<AJumpActor> It(&World); It; ++It)
+	{
+		const FJumpPadArc& Arc = It->GetLaunchArc();
+		if (!Arc.IsValid() || FVector::DistSquared(ViewLocation, Arc.LaunchLocation) > FMath::Square(TestProject2Debugger::JumpPadDrawDistance))
+		{
+			continue;
+		}
+		++NumPads;
+
+		FVector Previous = Arc.LaunchLocation;
+		for (int32 Segment = 1; Segment <= TestProject2Debugger::ArcSegments; ++Segment)
+		{
+			const FVector Next = Arc.Evaluate(Arc.FlightTime * Segment / TestProject2Debugger::ArcSegments);
+			AddShape(FGameplayDebuggerShape::MakeSegment(Previous, Next, 2.0f, FColor::Orange));
+			Previous = Next;
+		}
+		AddShape(FGameplayDebuggerShape::MakePoint(Arc.LandingLocation, 10.0f, FColor::Orange, FString::Printf(TEXT("%.2f s"), Arc.FlightTime)));
+	}
+
+	AddTextLine(FString::Printf(TEXT("{white}Jump pads in range: {yellow}%d"), NumPads));
+}
+
+#endif // WITH_GAMEPLAY_DEBUGGER
@@ -0,0 +1,33 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#if WITH_GAMEPLAY_DEBUGGER
+
+#include "CoreMinimal.h"
+#include "GameplayDebuggerCategory.h"
+
+class ATestProject2Character;
+
+/**
+ * 게임플레이 디버거 "TestProject2" 카테고리 (기본 단축키: 작은따옴표 키 후 숫자 패드).
+ * 선택한 (없으면 자신의) 캐릭터의 레지 프로브 / 올라가기 목표 / 몽타주 진행률, 주변 점프대의 발사 궤적과 착지 위치,
+ * 글로벌 / 캐릭터 시간 딜레이와 흑백화 채도를 보여줍니다.
+ * 데이터는 카테고리가 켜져 있을 때만 수집되며, Shipping / Test 빌드에서는 컴파일되지 않습니다.
+ */
+class FGameplayDebuggerCategory_TestProject2 : public FGameplayDebuggerCategory
+{
+public:
+	FGameplayDebuggerCategory_TestProject2();
+
+	virtual void CollectData(APlayerController* OwnerPC, AActor* DebugActor) override;
+
+	static TSharedRef<FGameplayDebuggerCategory> MakeInstance();
+
+private:
+	void CollectClimbing(const ATestProject2Character& Character);
+	void CollectJumpPads(const UWorld& World, const FVector& ViewLocation);
+	void CollectTimeDilation(const UWorld& World, const ATestProject2Character* Character);
+};
+
+#endif // WITH_GAMEPLAY_DEBUGGER
@@ -0,0 +1,237 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "InputLatencySubsystem.h"
+#include "TestProject2.h"
+#include "Engine/World.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/Controller.h"
+#include "GameFramework/WorldSettings.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+static int32 GInputLatencyEnable = 0;
+static FAutoConsoleVariableRef CVarInputLatencyEnable(
+	TEXT("TestProject2.InputLatency.Enable"),
+	GInputLatencyEnable,
+	TEXT("입력 -> 게임플레이 결과 지연 시간을 집계합니다."));
+
+static FAutoConsoleCommandWithWorldAndArgs CmdInputLatencyDump(
+	TEXT("TestProject2.InputLatency.Dump"),
+	TEXT("입력 지연 히스토그램을 CSV 로 기록합니다. 인자: [reset]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (UInputLatencySubsystem* Subsystem = UWorld::GetSubsystem<UInputLatencySubsystem>(World))
+		{
+			UE_LOG(LogTestProject2, Display, TEXT("Input latency written to %s"), *Subsystem->WriteCsv());
+			if (Args.Num() > 0 && Args[0] == TEXT("reset"))
+			{
+				Subsystem->Reset();
+			}
+		}
+	}));
+
+bool UInputLatencySubsystem::IsEnabled()
+{
+	return GInputLatencyEnable != 0;
+}
+
+const TCHAR* UInputLatencySubsystem::GetActionName(EInputLatencyAction Action)
+{
+	switch (Action)
+	{
+	case EInputLatencyAction::Move:			return TEXT("Move");
+	case EInputLatencyAction::Look:			return TEXT("Look");
+	case EInputLatencyAction::Climb:		return TEXT("Climb");
+	case EInputLatencyAction::SlowMotion:	return TEXT("SlowMotion");
+	default:								return TEXT("Unknown");
+	}
+}
+
+bool UInputLatencySubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+#if UE_BUILD_SHIPPING
+	return false;
+#else
+	return Super::ShouldCreateSubsystem(Outer);
+#endif
+}
+
+float UInputLatencySubsystem::GetCurrentDilation() const
+{
+	const AWorldSettings* WorldSettings = GetWorld()->GetWorldSettings();
+	return WorldSettings ? WorldSettings->GetEffectiveTimeDilation() : 1.0f;
+}
+
+void UInputLatencySubsystem::MarkInput(EInputLatencyAction Action, const ACharacter* Character)
+{
+	if (!IsEnabled() || Character == nullptr)
+	{
+		return;
+	}
+
+	FActionStats& Stats = Actions[(int32)Action];
+
+	// Triggered 이벤트는 누르고 있는 동안 매 프레임 들어오므로, 새로 누른 프레임만 측정
+	const bool bContinuation = Stats.LastInputFrame + 1 >= GFrameCounter && Stats.LastInputFrame != 0;
+	Stats.LastInputFrame = GFrameCounter;
+	if (bContinuation || Stats.Pending.bActive)
+	{
+		return;
+	}
+
+	FPendingInput& Pending = Stats.Pending;
+	Pending.InputSeconds = FPlatformTime::Seconds();
+	Pending.InputFrame = GFrameCounter;
+	Pending.Character = Character;
+	Pending.BaselineLocation = Character->GetActorLocation();
+	Pending.BaselineRotation = Character->GetController() ? Character->GetController()->GetControlRotation() : FRotator::ZeroRotator;
+	Pending.BaselineDilation = GetCurrentDilation();
+	Pending.bActive = true;
+}
+
+void UInputLatencySubsystem::MarkEffect(EInputLatencyAction Action)
+{
+	FActionStats& Stats = Actions[(int32)Action];
+	if (Stats.Pending.bActive)
+	{
+		AddSample(Action, Stats);
+	}
+}
+
+void UInputLatencySubsystem::AddSample(EInputLatencyAction Action, FActionStats& Stats)
+{
+	FLatencySample& Sample = Stats.Samples.AddDefaulted_GetRef();
+	Sample.InputFrame = Stats.Pending.InputFrame;
+	Sample.Frames = uint32(GFrameCounter - Stats.Pending.InputFrame);
+	Sample.Milliseconds = float((FPlatformTime::Seconds() - Stats.Pending.InputSeconds) * 1000.0);
+	++Stats.FrameHistogram[FMath::Min<int32>(Sample.Frames, NumFrameBins - 1)];
+	Stats.Pending.bActive = false;
+
+	switch (Action)
+	{
+	case EInputLatencyAction::Move:			SET_FLOAT_STAT(STAT_TP2_InputLatencyMove, Sample.Milliseconds); break;
+	case EInputLatencyAction::Look:			SET_FLOAT_STAT(STAT_TP2_InputLatencyLook, Sample.Milliseconds); break;
+	case EInputLatencyAction::Climb:		SET_FLOAT_STAT(STAT_TP2_InputLatencyClimb, Sample.Milliseconds); break;
+	case EInputLatencyAction::SlowMotion:	SET_FLOAT_STAT(STAT_TP2_InputLatencySlowMotion, Sample.Milliseconds); break;
+	default: break;
+	}
+}
+
+bool UInputLatencySubsystem::IsTickable() const
+{
+	for (const FActionStats& Stats : Actions)
+	{
+		if (Stats.Pending.bActive)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void UInputLatencySubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// 월드 틱 (이동 / 카메라 / 시간 딜레이 갱신) 이 끝난 뒤 호출되므로, 이번 프레임에 반영된 변화를 봄
+	for (int32 Index = 0; Index < (int32)EInputLatencyAction::Num; ++Index)
+	{
+		const EInputLatencyAction Action = (EInputLatencyAction)Index;
+		FActionStats& Stats = Actions[Index];
+		FPendingInput& Pending = Stats.Pending;
+		if (!Pending.bActive)
+		{
+			continue;
+		}
+
+		const ACharacter* Character = Pending.Character.Get();
+		if (Character == nullptr || GFrameCounter - Pending.InputFrame > TimeoutFrames)
+		{
+			++Stats.NumTimedOut;
+			Pending.bActive = false;
+			continue;
+		}
+
+		bool bEffect = false;
+		switch (Action)
+		{
+		case EInputLatencyAction::Move:
+			bEffect = !Character->GetActorLocation().Equals(Pending.BaselineLocation, 0.01f);
+			break;
+		case EInputLatencyAction::Look:
+			bEffect = Character->GetController() && !Character->GetController()->GetControlRotation().Equals(Pending.BaselineRotation, 0.001f);
+			break;
+		case EInputLatencyAction::SlowMotion:
+			bEffect = !FMath::IsNearlyEqual(GetCurrentDilation(), Pending.BaselineDilation);
+			break;
+		default:
+			break; // Climb 은 MarkEffect 로 보고됨
+		}
+
+		if (bEffect)
+		{
+			AddSample(Action, Stats);
+		}
+	}
+}
+
+FString UInputLatencySubsystem::WriteCsv() const
+{
+	FString Csv = TEXT("Action,Samples,TimedOut,AvgMs,P50Ms,P95Ms,P99Ms,MaxMs,AvgFrames");
+	for (int32 Bin = 0; Bin < NumFrameBins; ++Bin)
+	{
+		Csv += Bin == NumFrameBins - 1 ? FString::Printf(TEXT(",Frames%d+"), Bin) : FString::Printf(TEXT(",Frames%d"), Bin);
+	}
+	Csv += LINE_TERMINATOR;
+
+	for (int32 Index = 0; Index < (int32)EInputLatencyAction::Num; ++Index)
+	{
+		const FActionStats& Stats = Actions[Index];
+
+		TArray<float> Milliseconds;
+		double TotalMs = 0.0;
+		double TotalFrames = 0.0;
+		for (const FLatencySample& Sample : Stats.Samples)
+		{
+			Milliseconds.Add(Sample.Milliseconds);
+			TotalMs += Sample.Milliseconds;
+			TotalFrames += Sample.Frames;
+		}
+		Milliseconds.Sort();
+
+		auto Percentile = [&Milliseconds](float Fraction)
+		{
+			return Milliseconds.Num() > 0 ? Milliseconds[FMath::Min(Milliseconds.Num() - 1, FMath::FloorToInt32(Fraction * Milliseconds.Num()))] : 0.0f;
+		};
+
+		const int32 NumSamples = Stats.Samples.Num();
+		Csv += FString::Printf(TEXT("%s,%d,%u,%.3f,%.3f,%.3f,%.3f,%.3f,%.2f"),
+			GetActionName((EInputLatencyAction)Index), NumSamples, Stats.NumTimedOut,
+			NumSamples > 0 ? TotalMs / NumSamples : 0.0, Percentile(0.5f), Percentile(0.95f), Percentile(0.99f),
+			NumSamples > 0 ? Milliseconds.Last() : 0.0f, NumSamples > 0 ? TotalFrames / NumSamples : 0.0);
+		for (int32 Bin = 0; Bin < NumFrameBins; ++Bin)
+		{
+			Csv += FString::Printf(TEXT(",%u"), Stats.FrameHistogram[Bin]);
+		}
+		Csv += LINE_TERMINATOR;
+	}
+
+	const FString Path = FPaths::ProjectSavedDir() / TEXT("Profiling/InputLatency") / FString::Printf(TEXT("InputLatency_%s.csv"), *FDateTime::Now().ToString());
+	FFileHelper::SaveStringToFile(Csv, *Path);
+	return Path;
+}
+
+void UInputLatencySubsystem::Reset()
+{
+	for (FActionStats& Stats : Actions)
+	{
+		Stats = FActionStats();
+	}
+}
+
+TStatId UInputLatencySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UInputLatencySubsystem, STATGROUP_Tickables);
+}
@@ -0,0 +1,97 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "InputLatencySubsystem.generated.h"
+
+class ACharacter;
+
+/** 지연 시간을 재는 입력 액션 */
+enum class EInputLatencyAction : uint8
+{
+	Move,		// 입력 -> 캐릭터 위치가 처음 바뀐 프레임
+	Look,		// 입력 -> 컨트롤 회전이 처음 바뀐 프레임
+	Climb,		// 입력 -> 올라가기 몽타주 시작
+	SlowMotion,	// 입력 -> 새 시간 딜레이가 처음 적용된 프레임
+	Num
+};
+
+/**
+ * Enhanced Input 바인딩의 입력 -> 게임플레이 결과 지연 시간을 프레임 / 밀리초 히스토그램으로 집계합니다.
+ * 입력 핸들러에서 MarkInput, 결과가 이벤트로 나타나는 곳 (몽타주 시작) 에서 MarkEffect 를 호출하고,
+ * 위치 / 회전 / 시간 딜레이 변화는 월드 틱이 끝난 뒤 폴링합니다.
+ * TestProject2.InputLatency.Enable 1 로 켜고, TestProject2.InputLatency.Dump 로 Saved/Profiling/InputLatency 에 CSV 를 기록합니다.
+ * Shipping 빌드에서는 생성되지 않습니다.
+ */
+UCLASS()
+class TESTPROJECT2_API UInputLatencySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** 입력 이벤트 시각 기록 (이미 결과를 기다리는 입력이 있거나, 지난 프레임부터 이어지는 입력이면 무시) */
+	void MarkInput(EInputLatencyAction Action, const ACharacter* Character);
+
+	/** 결과 시각 기록 (기다리는 입력이 있을 때만 샘플 추가) */
+	void MarkEffect(EInputLatencyAction Action);
+
+	/** 액션별 히스토그램 / 백분위를 CSV 로 기록하고 경로를 반환 */
+	FString WriteCsv() const;
+
+	/** 수집한 샘플 초기화 */
+	void Reset();
+
+	static bool IsEnabled();
+	static const TCHAR* GetActionName(EInputLatencyAction Action);
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+private:
+	/** 결과를 기다리는 입력 */
+	struct FPendingInput
+	{
+		double InputSeconds = 0.0;
+		uint64 InputFrame = 0;
+		TWeakObjectPtr<const ACharacter> Character;
+		/** 변화 감지 기준값 (위치 / 회전 / 시간 딜레이) */
+		FVector BaselineLocation = FVector::ZeroVector;
+		FRotator BaselineRotation = FRotator::ZeroRotator;
+		float BaselineDilation = 1.0f;
+		bool bActive = false;
+	};
+
+	struct FLatencySample
+	{
+		uint64 InputFrame = 0;
+		uint32 Frames = 0;
+		float Milliseconds = 0.0f;
+	};
+
+	/** 프레임 히스토그램 칸 수 (마지막 칸 = 그 이상) */
+	static constexpr int32 NumFrameBins = 10;
+
+	/** 이 프레임 수가 지나도록 결과가 없으면 (레지가 없어 올라가지 않은 경우 등) 버림 */
+	static constexpr uint64 TimeoutFrames = 60;
+
+	struct FActionStats
+	{
+		FPendingInput Pending;
+		/** 같은 입력이 연속 프레임에서 들어오는지 (Triggered) 판단용 */
+		uint64 LastInputFrame = 0;
+		TArray<FLatencySample> Samples;
+		uint32 FrameHistogram[NumFrameBins] = {};
+		uint32 NumTimedOut = 0;
+	};
+
+	void AddSample(EInputLatencyAction Action, FActionStats& Stats);
+	float GetCurrentDilation() const;
+
+	FActionStats Actions[(int32)EInputLatencyAction::Num];
+};
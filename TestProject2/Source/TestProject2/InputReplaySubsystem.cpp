@@ -0,0 +1,342 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "InputReplaySubsystem.h"
+#include "TestProject2Character.h"
+#include "TestProject2.h"
+#include "Containers/Ticker.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/WorldSettings.h"
+#include "HAL/IConsoleManager.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+static FAutoConsoleCommandWithWorldAndArgs CmdInputRecordStart(
+	TEXT("TestProject2.InputRecord.Start"),
+	TEXT("로컬 플레이어 캐릭터 입력 녹화를 시작합니다. 인자: [파일]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (UInputReplaySubsystem* Subsystem = UWorld::GetSubsystem<UInputReplaySubsystem>(World))
+		{
+			Subsystem->StartRecording(Args.Num() > 0 ? Args[0] : FString::Printf(TEXT("Input_%s.tp2input"), *FDateTime::Now().ToString()));
+		}
+	}));
+
+static FAutoConsoleCommandWithWorld CmdInputRecordStop(
+	TEXT("TestProject2.InputRecord.Stop"),
+	TEXT("입력 녹화를 멈추고 파일로 저장합니다."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (UInputReplaySubsystem* Subsystem = UWorld::GetSubsystem<UInputReplaySubsystem>(World))
+		{
+			Subsystem->StopRecording();
+		}
+	}));
+
+FString UInputReplaySubsystem::ResolvePath(const FString& Filename)
+{
+	return FPaths::IsRelative(Filename) ? FPaths::ProjectSavedDir() / TEXT("InputRecordings") / Filename : Filename;
+}
+
+bool UInputReplaySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UInputReplaySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	PreActorTickHandle = FWorldDelegates::OnWorldPreActorTick.AddUObject(this, &UInputReplaySubsystem::OnPreActorTick);
+	PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &UInputReplaySubsystem::OnPostActorTick);
+}
+
+void UInputReplaySubsystem::Deinitialize()
+{
+	if (bRecording)
+	{
+		StopRecording();
+	}
+
+	FWorldDelegates::OnWorldPreActorTick.Remove(PreActorTickHandle);
+	FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+
+	Super::Deinitialize();
+}
+
+void UInputReplaySubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	FString Filename;
+	if (FParse::Value(FCommandLine::Get(), TEXT("TP2ReplayInput="), Filename))
+	{
+		bExitAfterReplay = StartReplay(Filename);
+	}
+	else if (FParse::Value(FCommandLine::Get(), TEXT("TP2RecordInput="), Filename))
+	{
+		StartRecording(Filename);
+	}
+}
+
+ATestProject2Character* UInputReplaySubsystem::GetPlayerCharacter() const
+{
+	return Cast<ATestProject2Character>(UGameplayStatics::GetPlayerPawn(GetWorld(), 0));
+}
+
+void UInputReplaySubsystem::StartRecording(const FString& Filename)
+{
+	if (bReplaying)
+	{
+		return;
+	}
+
+	SessionFilename = ResolvePath(Filename);
+	FixedDeltaSeconds = FApp::UseFixedTimeStep() ? float(FApp::GetFixedDeltaTime()) : 1.0f / 60.0f;
+	Inputs.Reset();
+	SessionFrame = INDEX_NONE;
+	bRecording = true;
+}
+
+bool UInputReplaySubsystem::StopRecording()
+{
+	if (!bRecording)
+	{
+		return false;
+	}
+	bRecording = false;
+
+	uint32 Magic = FileMagic;
+	uint32 Version = FileVersion;
+	int32 NumInputs = Inputs.Num();
+
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+	Writer << Magic << Version << FixedDeltaSeconds << NumInputs;
+	for (FRecordedInput& Input : Inputs)
+	{
+		Writer << Input;
+	}
+
+	const bool bSaved = FFileHelper::SaveArrayToFile(Bytes, *SessionFilename);
+	UE_LOG(LogTestProject2, Display, TEXT("Input recording: %d inputs over %lld frames -> %s%s"), NumInputs, SessionFrame + 1, *SessionFilename, bSaved ? TEXT("") : TEXT(" (failed to write)"));
+	return bSaved;
+}
+
+bool UInputReplaySubsystem::StartReplay(const FString& Filename)
+{
+	SessionFilename = ResolvePath(Filename);
+
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *SessionFilename))
+	{
+		UE_LOG(LogTestProject2, Error, TEXT("Input replay: failed to read %s"), *SessionFilename);
+		return false;
+	}
+
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	int32 NumInputs = 0;
+	FMemoryReader Reader(Bytes);
+	Reader << Magic << Version << FixedDeltaSeconds << NumInputs;
+	if (Magic != FileMagic || Version != FileVersion || NumInputs < 0 || FixedDeltaSeconds <= 0.0f)
+	{
+		UE_LOG(LogTestProject2, Error, TEXT("Input replay: %s is not a supported recording"), *SessionFilename);
+		return false;
+	}
+
+	Inputs.SetNum(NumInputs);
+	for (FRecordedInput& Input : Inputs)
+	{
+		Reader << Input;
+	}
+	if (Reader.IsError())
+	{
+		UE_LOG(LogTestProject2, Error, TEXT("Input replay: %s is truncated"), *SessionFilename);
+		return false;
+	}
+
+	// 벽시계와 무관하게 매 프레임 같은 델타로 진행
+	FApp::SetUseFixedTimeStep(true);
+	FApp::SetFixedDeltaTime(FixedDeltaSeconds);
+
+	NextReplayInput = 0;
+	SessionFrame = INDEX_NONE;
+	FrameMs.Reset();
+	ActorTickMs.Reset();
+	bReplaying = true;
+	return true;
+}
+
+void UInputReplaySubsystem::RecordInput(const ATestProject2Character* Character, EInputReplayAction Action, const FVector2D& Value)
+{
+	if (!bRecording || SessionFrame == INDEX_NONE || Character != GetPlayerCharacter())
+	{
+		return;
+	}
+
+	FRecordedInput& Input = Inputs.AddDefaulted_GetRef();
+	Input.Frame = uint32(SessionFrame);
+	Input.Action = uint8(Action);
+	Input.Value = FVector2f(Value);
+}
+
+void UInputReplaySubsystem::OnPreActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds)
+{
+	if (InWorld != GetWorld() || !(bRecording || bReplaying))
+	{
+		return;
+	}
+
+	ATestProject2Character* Character = GetPlayerCharacter();
+	if (SessionFrame == INDEX_NONE)
+	{
+		// 플레이어 캐릭터가 스폰된 첫 프레임부터 셈
+		if (Character == nullptr)
+		{
+			return;
+		}
+		SessionFrame = 0;
+
+		// CSV 캡처 비교 도구가 두 캡처를 이 프레임 기준으로 정렬
+		if (bReplaying)
+		{
+			CSV_EVENT(TestProject2, TEXT("ReplayStart"));
+		}
+	}
+	else
+	{
+		++SessionFrame;
+	}
+
+	if (!bReplaying)
+	{
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	if (SessionFrame > 0)
+	{
+		FrameMs.Add(float((Now - LastFrameStartSeconds) * 1000.0));
+	}
+	LastFrameStartSeconds = Now;
+	PreActorTickSeconds = Now;
+
+	// 녹화 때 플레이어 컨트롤러 틱 (액터 틱 안) 에서 처리된 입력을 같은 프레임의 액터 틱 직전에 주입
+	while (Character && Inputs.IsValidIndex(NextReplayInput) && Inputs[NextReplayInput].Frame <= uint32(SessionFrame))
+	{
+		const FRecordedInput& Input = Inputs[NextReplayInput++];
+		Character->ApplyReplayedInput(EInputReplayAction(Input.Action), FVector2D(Input.Value));
+	}
+}
+
+void UInputReplaySubsystem::OnPostActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds)
+{
+	if (InWorld != GetWorld() || !bReplaying || SessionFrame == INDEX_NONE)
+	{
+		return;
+	}
+
+	ActorTickMs.Add(float((FPlatformTime::Seconds() - PreActorTickSeconds) * 1000.0));
+
+	const uint32 LastInputFrame = Inputs.Num() > 0 ? Inputs.Last().Frame : 0;
+	if (NextReplayInput >= Inputs.Num() && uint32(SessionFrame) >= LastInputFrame + SettleFrames)
+	{
+		FinishReplay();
+	}
+}
+
+uint32 UInputReplaySubsystem::ComputeStateChecksum() const
+{
+	// 이름 순으로 정렬하여 스폰 순서와 무관하게, 0.01 단위로 양자화하여 기록
+	TArray<const ATestProject2Character*> Characters;
+	for (TActorIterator<ATestProject2Character> It(GetWorld()); It; ++It)
+	{
+		Characters.Add(*It);
+	}
+	Characters.Sort([](const ATestProject2Character& A, const ATestProject2Character& B) { return A.GetFName().LexicalLess(B.GetFName()); });
+
+	TArray<int64> State;
+	auto AddVector = [&State](const FVector& Vector)
+	{
+		State.Add(FMath::RoundToInt64(Vector.X * 100.0));
+		State.Add(FMath::RoundToInt64(Vector.Y * 100.0));
+		State.Add(FMath::RoundToInt64(Vector.Z * 100.0));
+	};
+
+	for (const ATestProject2Character* Character : Characters)
+	{
+		AddVector(Character->GetActorLocation());
+		AddVector(Character->GetActorRotation().Euler());
+		AddVector(Character->GetVelocity());
+		if (const UCharacterMovementComponent* Movement = Character->GetCharacterMovement())
+		{
+			State.Add(Movement->MovementMode);
+			State.Add(Movement->CustomMovementMode);
+		}
+	}
+
+	const AWorldSettings* WorldSettings = GetWorld()->GetWorldSettings();
+	State.Add(FMath::RoundToInt64((WorldSettings ? WorldSettings->GetEffectiveTimeDilation() : 1.0f) * 1000.0));
+
+	return FCrc::MemCrc32(State.GetData(), State.Num() * State.GetTypeSize());
+}
+
+void UInputReplaySubsystem::FinishReplay()
+{
+	bReplaying = false;
+	CSV_EVENT(TestProject2, TEXT("ReplayEnd"));
+
+	const uint32 Checksum = ComputeStateChecksum();
+
+	FString Csv = TEXT("Frame,FrameMs,ActorTickMs") LINE_TERMINATOR;
+	double TotalFrameMs = 0.0;
+	for (int32 Frame = 0; Frame < ActorTickMs.Num(); ++Frame)
+	{
+		const float FrameTimeMs = FrameMs.IsValidIndex(Frame - 1) ? FrameMs[Frame - 1] : 0.0f;
+		TotalFrameMs += FrameTimeMs;
+		Csv += FString::Printf(TEXT("%d,%.3f,%.3f") LINE_TERMINATOR, Frame, FrameTimeMs, ActorTickMs[Frame]);
+	}
+	Csv += FString::Printf(TEXT("Checksum,%08X,") LINE_TERMINATOR, Checksum);
+
+	const FString CsvPath = FPaths::ProjectSavedDir() / TEXT("Profiling/InputReplay")
+		/ FString::Printf(TEXT("%s_%s.csv"), *FPaths::GetBaseFilename(SessionFilename), *FDateTime::Now().ToString());
+	FFileHelper::SaveStringToFile(Csv, *CsvPath);
+
+	TArray<float> SortedActorTickMs = ActorTickMs;
+	SortedActorTickMs.Sort();
+	const float P99 = SortedActorTickMs.Num() > 0 ? SortedActorTickMs[FMath::Min(SortedActorTickMs.Num() - 1, FMath::FloorToInt32(0.99f * SortedActorTickMs.Num()))] : 0.0f;
+
+	UE_LOG(LogTestProject2, Display, TEXT("Input replay finished: %d frames, %.3f ms avg frame, %.3f ms p99 actor tick, checksum %08X -> %s"),
+		ActorTickMs.Num(), FrameMs.Num() > 0 ? TotalFrameMs / FrameMs.Num() : 0.0, P99, Checksum, *CsvPath);
+
+	if (bExitAfterReplay)
+	{
+#if CSV_PROFILER
+		// -csvCaptureFrames 등으로 켠 CSV 캡처는 파일이 다 써진 뒤에 종료
+		if (FCsvProfiler::Get()->IsCapturing())
+		{
+			TSharedFuture<FString> CsvFilename = FCsvProfiler::Get()->EndCapture();
+			FTSTicker::GetCoreTicker().AddTicker(TEXT("InputReplayCsv"), 0.0f, [CsvFilename](float)
+			{
+				if (!CsvFilename.IsReady())
+				{
+					return true;
+				}
+				UE_LOG(LogTestProject2, Display, TEXT("Input replay: CSV profile -> %s"), *CsvFilename.Get());
+				FPlatformMisc::RequestExit(false, TEXT("InputReplay"));
+				return false;
+			});
+			return;
+		}
+#endif
+		FPlatformMisc::RequestExit(false, TEXT("InputReplay"));
+	}
+}
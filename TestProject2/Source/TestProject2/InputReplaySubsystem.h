@@ -0,0 +1,121 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "InputReplaySubsystem.generated.h"
+
+class ATestProject2Character;
+
+/** 녹화되는 캐릭터 입력 액션 (IA_Move, IA_Look, IA_Jump, IA_ClimbAction, IA_ToggleSlowMotion) */
+enum class EInputReplayAction : uint8
+{
+	Move,
+	Look,
+	JumpStarted,
+	JumpCompleted,
+	Climb,
+	ToggleSlowMotion,
+	Num
+};
+
+/**
+ * 빌드 간 성능 비교용 입력 녹화 / 재생.
+ *
+ * 녹화: 로컬 플레이어 캐릭터의 입력 핸들러 호출을 (프레임 번호, 액션, 값) 으로 기록하여 바이너리 파일로 저장합니다.
+ *   -TP2RecordInput=<파일> 또는 콘솔 TestProject2.InputRecord.Start [파일] / TestProject2.InputRecord.Stop
+ * 재생: 고정 타임스텝으로 같은 프레임에 같은 핸들러를 호출하고, 프레임별 시간 CSV 와 최종 상태 체크섬을 남긴 뒤 종료합니다.
+ *   UnrealEditor-Cmd TestProject2.uproject /Game/ThirdPerson/Maps/ThirdPersonMap -game -nullrhi -TP2ReplayInput=<파일>
+ *
+ * -csvCaptureFrames=<N> 를 함께 주면 CSV 프로파일러 캡처에 ReplayStart / ReplayEnd 이벤트를 남기고, 파일이 써진 뒤 종료합니다.
+ *   두 캡처는 Tools/PerfCompare/compare_csv_profiles.py 로 비교합니다.
+ *
+ * 같은 녹화 파일의 재생끼리는 결정적이므로 (고정 델타, 같은 프레임에 입력 주입), 체크섬이 다르면 모듈 동작이 달라진 것입니다.
+ * 상대 경로는 Saved/InputRecordings 기준이며, 결과는 Saved/Profiling/InputReplay 에 기록됩니다.
+ */
+UCLASS()
+class TESTPROJECT2_API UInputReplaySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** 녹화 시작 (로컬 플레이어 캐릭터가 생기는 첫 프레임이 0 번 프레임) */
+	void StartRecording(const FString& Filename);
+
+	/** 녹화를 멈추고 파일로 저장 */
+	bool StopRecording();
+
+	/** 재생 시작 (고정 타임스텝으로 전환) */
+	bool StartReplay(const FString& Filename);
+
+	bool IsRecording() const { return bRecording; }
+	bool IsReplaying() const { return bReplaying; }
+
+	/** 캐릭터 입력 핸들러에서 호출 (녹화 중이고 녹화 대상 캐릭터일 때만 기록) */
+	void RecordInput(const ATestProject2Character* Character, EInputReplayAction Action, const FVector2D& Value);
+
+	/** 월드의 모든 TestProject2 캐릭터 상태 (트랜스폼, 속도, 이동 모드) 와 시간 딜레이의 체크섬 */
+	uint32 ComputeStateChecksum() const;
+
+	static FString ResolvePath(const FString& Filename);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** 파일 배치 그대로의 입력 이벤트 (16 바이트) */
+	struct FRecordedInput
+	{
+		uint32 Frame = 0;
+		uint8 Action = 0;
+		uint8 Reserved[3] = {};
+		FVector2f Value = FVector2f::ZeroVector;
+
+		friend FArchive& operator<<(FArchive& Ar, FRecordedInput& Input)
+		{
+			Ar << Input.Frame << Input.Action;
+			Ar.Serialize(Input.Reserved, sizeof(Input.Reserved));
+			Ar << Input.Value;
+			return Ar;
+		}
+	};
+
+	/** "TP2I" */
+	static constexpr uint32 FileMagic = 0x49325054;
+	static constexpr uint32 FileVersion = 1;
+
+	/** 마지막 입력 뒤 체크섬을 계산하기 전에 더 진행할 프레임 수 (착지 / 몽타주 / 슬로우 모션 전환 완료) */
+	static constexpr uint32 SettleFrames = 120;
+
+	void OnPreActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds);
+	void OnPostActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds);
+
+	ATestProject2Character* GetPlayerCharacter() const;
+	void FinishReplay();
+
+	FDelegateHandle PreActorTickHandle;
+	FDelegateHandle PostActorTickHandle;
+
+	/** 녹화 / 재생 0 번 프레임부터 센 월드 틱 수 (캐릭터가 생기기 전에는 INDEX_NONE) */
+	int64 SessionFrame = INDEX_NONE;
+
+	bool bRecording = false;
+	bool bReplaying = false;
+
+	/** 명령줄로 시작한 재생이면 끝난 뒤 종료 */
+	bool bExitAfterReplay = false;
+
+	FString SessionFilename;
+	float FixedDeltaSeconds = 1.0f / 60.0f;
+	TArray<FRecordedInput> Inputs;
+	int32 NextReplayInput = 0;
+
+	/** 재생 중 프레임별 시간 (전체 프레임 / 액터 틱) */
+	double PreActorTickSeconds = 0.0;
+	double LastFrameStartSeconds = 0.0;
+	TArray<float> FrameMs;
+	TArray<float> ActorTickMs;
+};
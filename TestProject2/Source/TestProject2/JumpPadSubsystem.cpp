@@ -0,0 +1,120 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "JumpPadSubsystem.h"
+#include "TestProject2.h"
+#include "EffectPoolSubsystem.h"
+#include "Components/PrimitiveComponent.h"
+#include "GameFramework/Character.h"
+
+int32 UJumpPadSubsystem::RegisterPad(AActor* Owner, UPrimitiveComponent* Volume, const FVector& LaunchVelocity)
+{
+	if (Volume == nullptr)
+	{
+		return INDEX_NONE;
+	}
+
+	FJumpPad Entry;
+	Entry.Owner = Owner;
+	Entry.Volume = Volume;
+	Entry.VolumeKey = Volume;
+	Entry.LaunchVelocity = LaunchVelocity;
+
+	const int32 Handle = Pads.Add(MoveTemp(Entry));
+	VolumeToPad.Add(Volume, Handle);
+	Volume->OnComponentBeginOverlap.AddDynamic(this, &UJumpPadSubsystem::OnPadVolumeBeginOverlap);
+
+	return Handle;
+}
+
+void UJumpPadSubsystem::UnregisterPad(int32 Handle)
+{
+	if (!Pads.IsValidIndex(Handle))
+	{
+		return;
+	}
+
+	if (UPrimitiveComponent* Volume = Pads[Handle].Volume.Get())
+	{
+		Volume->OnComponentBeginOverlap.RemoveDynamic(this, &UJumpPadSubsystem::OnPadVolumeBeginOverlap);
+	}
+	VolumeToPad.Remove(Pads[Handle].VolumeKey);
+	Pads.RemoveAt(Handle);
+
+	PendingLaunches.RemoveAll([Handle](const FPendingLaunch& Launch) { return Launch.PadHandle == Handle; });
+}
+
+void UJumpPadSubsystem::OnPadVolumeBeginOverlap(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+{
+	TP2_SCOPE_CYCLE_COUNTER(STAT_TP2_JumpPadOverlap);
+
+	// 점프대 볼륨은 Pawn 과만 오버랩하므로 여기에는 폰만 들어옴
+	ACharacter* Character = Cast<ACharacter>(OtherActor);
+	const int32* Handle = VolumeToPad.Find(OverlappedComp);
+	if (Character == nullptr || Handle == nullptr)
+	{
+		return;
+	}
+
+	// 같은 프레임에 여러 점프대에 닿으면 먼저 닿은 점프대만 적용
+	if (PendingLaunches.ContainsByPredicate([Character](const FPendingLaunch& Launch) { return Launch.Character == Character; }))
+	{
+		return;
+	}
+
+	FPendingLaunch& Launch = PendingLaunches.AddDefaulted_GetRef();
+	Launch.Character = Character;
+	Launch.PadHandle = *Handle;
+}
+
+bool UJumpPadSubsystem::IsTickable() const
+{
+	// 발사 대기열이 있는 프레임에만 틱
+	return PendingLaunches.Num() > 0;
+}
+
+void UJumpPadSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	DispatchLaunches();
+}
+
+void UJumpPadSubsystem::DispatchLaunches()
+{
+	TP2_SCOPE_CYCLE_COUNTER(STAT_TP2_JumpPadDispatch);
+	INC_DWORD_STAT_BY(STAT_TP2_JumpPadLaunches, PendingLaunches.Num());
+	CSV_CUSTOM_STAT(TestProject2, JumpPadLaunches, PendingLaunches.Num(), ECsvCustomStatOp::Accumulate);
+
+	UEffectPoolSubsystem* Effects = UWorld::GetSubsystem<UEffectPoolSubsystem>(GetWorld());
+
+	for (const FPendingLaunch& Launch : PendingLaunches)
+	{
+		ACharacter* Character = Launch.Character.Get();
+		if (Character && Pads.IsValidIndex(Launch.PadHandle))
+		{
+			const FJumpPad& Pad = Pads[Launch.PadHandle];
+			Character->LaunchCharacter(Pad.LaunchVelocity, true, true); // XY와 Z 모두 현재 속도 무시
+
+			if (Effects)
+			{
+				const UPrimitiveComponent* Volume = Pad.Volume.Get();
+				Effects->PlayEffect(EPooledEffect::JumpPadLaunch, Volume ? Volume->GetComponentLocation() : Character->GetActorLocation(), Pad.LaunchVelocity.Rotation());
+			}
+		}
+	}
+	PendingLaunches.Reset();
+}
+
+void UJumpPadSubsystem::Deinitialize()
+{
+	PendingLaunches.Empty();
+	VolumeToPad.Empty();
+	Pads.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UJumpPadSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UJumpPadSubsystem, STATGROUP_Tickables);
+}
@@ -0,0 +1,67 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "JumpPadSubsystem.generated.h"
+
+class ACharacter;
+class UPrimitiveComponent;
+
+/**
+ * 월드의 모든 점프대 볼륨을 한 곳에서 관리합니다.
+ * 점프대는 BeginPlay / EndPlay 에서 볼륨과 미리 계산한 발사 속도를 등록 / 해제하고, 틱하지 않습니다.
+ * 볼륨 오버랩은 발사 대기열에만 쌓이며, 대기열이 있는 프레임에만 한 번에 모아서 LaunchCharacter 를 호출합니다.
+ */
+UCLASS()
+class TESTPROJECT2_API UJumpPadSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** 점프대 볼륨과 발사 속도를 등록하고 해제용 핸들을 반환 (Owner 는 AJumpActor 또는 구워진 셀의 AGameplayCellData) */
+	int32 RegisterPad(AActor* Owner, UPrimitiveComponent* Volume, const FVector& LaunchVelocity);
+
+	/** RegisterPad 로 등록한 점프대를 해제 */
+	void UnregisterPad(int32 Handle);
+
+	/** 등록된 점프대 수 */
+	int32 GetNumPads() const { return Pads.Num(); }
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+	virtual void Deinitialize() override;
+
+private:
+	struct FJumpPad
+	{
+		TWeakObjectPtr<AActor> Owner;
+		TWeakObjectPtr<UPrimitiveComponent> Volume;
+		TObjectKey<UPrimitiveComponent> VolumeKey;
+		FVector LaunchVelocity = FVector::ZeroVector;
+	};
+
+	struct FPendingLaunch
+	{
+		TWeakObjectPtr<ACharacter> Character;
+		int32 PadHandle = INDEX_NONE;
+	};
+
+	UFUNCTION()
+	void OnPadVolumeBeginOverlap(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
+
+	/** 대기열의 발사를 한 번에 처리 */
+	void DispatchLaunches();
+
+	TSparseArray<FJumpPad> Pads;
+
+	/** 볼륨 -> 점프대 핸들 */
+	TMap<TObjectKey<UPrimitiveComponent>, int32> VolumeToPad;
+
+	/** 이번 프레임에 발사할 캐릭터 (캐릭터당 한 번) */
+	TArray<FPendingLaunch> PendingLaunches;
+};
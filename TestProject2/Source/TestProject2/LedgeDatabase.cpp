@@ -0,0 +1,189 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LedgeDatabase.h"
+#include "TestProject2.h"
+#include "ClimbableSubsystem.h"
+#include "Algo/BinarySearch.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+
+FLedgeDatabase::~FLedgeDatabase()
+{
+	// 영역을 핸들보다 먼저 해제
+	MappedRegion.Reset();
+	MappedHandle.Reset();
+}
+
+FString FLedgeDatabase::GetFilenameForMap(const FString& MapName)
+{
+	return FPaths::ProjectContentDir() / TEXT("LedgeDatabase") / FPackageName::GetShortName(MapName) + TEXT(".tp2ledge");
+}
+
+TUniquePtr<FLedgeDatabase> FLedgeDatabase::Open(const FString& Filename)
+{
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	if (!PlatformFile.FileExists(*Filename))
+	{
+		return nullptr;
+	}
+
+	TUniquePtr<FLedgeDatabase> Database(new FLedgeDatabase());
+
+	FOpenMappedResult MappedResult = PlatformFile.OpenMappedEx(*Filename);
+	if (!MappedResult.HasError())
+	{
+		Database->MappedHandle = MappedResult.StealValue();
+		Database->MappedRegion.Reset(Database->MappedHandle->MapRegion(0, Database->MappedHandle->GetFileSize()));
+	}
+
+	if (Database->MappedRegion.IsValid())
+	{
+		if (!Database->Bind(Database->MappedRegion->GetMappedPtr(), Database->MappedRegion->GetMappedSize()))
+		{
+			return nullptr;
+		}
+	}
+	else
+	{
+		// 매핑할 수 없으면 한 번 읽어서 같은 방식으로 사용 (역시 파싱 없음)
+		if (!FFileHelper::LoadFileToArray(Database->FallbackData, *Filename) || !Database->Bind(Database->FallbackData.GetData(), Database->FallbackData.Num()))
+		{
+			return nullptr;
+		}
+	}
+
+	return Database;
+}
+
+bool FLedgeDatabase::Bind(const uint8* Data, int64 Size)
+{
+	using namespace LedgeDatabase;
+
+	if (Data == nullptr || Size < int64(sizeof(FHeader)) || !IsAligned(Data, alignof(FCell)))
+	{
+		return false;
+	}
+
+	const FHeader& Header = *reinterpret_cast<const FHeader*>(Data);
+	if (Header.Magic != Magic || Header.Version != Version || Header.CellSize <= 0.0f)
+	{
+		UE_LOG(LogTestProject2, Warning, TEXT("Ledge database has an unsupported header (magic %08x, version %u), ignoring it"), Header.Magic, Header.Version);
+		return false;
+	}
+
+	auto IsInRange = [Size](uint32 Offset, uint64 Count, uint64 Stride, uint64 Alignment)
+	{
+		return Offset % Alignment == 0 && uint64(Offset) + Count * Stride <= uint64(Size);
+	};
+
+	if (!IsInRange(Header.CellsOffset, Header.NumCells, sizeof(FCell), alignof(FCell))
+		|| !IsInRange(Header.IndicesOffset, Header.NumLedgeIndices, sizeof(uint32), alignof(uint32))
+		|| !IsInRange(Header.LedgesOffset, Header.NumLedges, sizeof(FLedge), alignof(FLedge)))
+	{
+		UE_LOG(LogTestProject2, Warning, TEXT("Ledge database is truncated, ignoring it"));
+		return false;
+	}
+
+	Cells = MakeArrayView(reinterpret_cast<const FCell*>(Data + Header.CellsOffset), Header.NumCells);
+	LedgeIndices = MakeArrayView(reinterpret_cast<const uint32*>(Data + Header.IndicesOffset), Header.NumLedgeIndices);
+	Ledges = MakeArrayView(reinterpret_cast<const FLedge*>(Data + Header.LedgesOffset), Header.NumLedges);
+	CellSize = Header.CellSize;
+	SizeBytes = Size;
+
+	// 인덱스 범위만 확인 (내용은 쿠킹 전에 만든 그대로 신뢰). 질의는 이 값들을 검사 없이 따라가므로 하나라도 벗어나면 파일 전체를 버림
+	for (const FCell& Cell : Cells)
+	{
+		if (uint64(Cell.FirstIndex) + Cell.NumIndices > uint64(LedgeIndices.Num()))
+		{
+			UE_LOG(LogTestProject2, Warning, TEXT("Ledge database has a cell outside its index table, ignoring it"));
+			return false;
+		}
+	}
+	for (const uint32 LedgeIndex : LedgeIndices)
+	{
+		if (LedgeIndex >= uint32(Ledges.Num()))
+		{
+			UE_LOG(LogTestProject2, Warning, TEXT("Ledge database has a ledge index out of range (%u >= %d), ignoring it"), LedgeIndex, Ledges.Num());
+			return false;
+		}
+	}
+	return true;
+}
+
+const LedgeDatabase::FCell* FLedgeDatabase::FindCell(int64 Key) const
+{
+	const int32 Index = Algo::BinarySearchBy(Cells, Key, &LedgeDatabase::FCell::Key);
+	return Index != INDEX_NONE ? &Cells[Index] : nullptr;
+}
+
+#if WITH_EDITOR
+bool FLedgeDatabase::Write(const FString& Filename, TConstArrayView<FClimbableLedge> InLedges, TConstArrayView<float> Clearances, float InCellSize)
+{
+	using namespace LedgeDatabase;
+
+	check(InLedges.Num() == Clearances.Num());
+	check(InCellSize > 0.0f);
+
+	// 레지가 걸친 칸마다 인덱스 등록
+	TMap<int64, TArray<uint32>> CellMap;
+	TArray<FLedge> Records;
+	Records.Reserve(InLedges.Num());
+
+	for (int32 LedgeIndex = 0; LedgeIndex < InLedges.Num(); ++LedgeIndex)
+	{
+		const FClimbableLedge& Ledge = InLedges[LedgeIndex];
+
+		FLedge& Record = Records.AddZeroed_GetRef();
+		Record.Start = FVector3f(Ledge.Start);
+		Record.End = FVector3f(Ledge.End);
+		Record.OutwardNormal = FVector2f(Ledge.OutwardNormal.X, Ledge.OutwardNormal.Y);
+		Record.Clearance = Clearances[LedgeIndex];
+
+		const FVector Min = Ledge.Start.ComponentMin(Ledge.End);
+		const FVector Max = Ledge.Start.ComponentMax(Ledge.End);
+		for (int32 X = FMath::FloorToInt32(Min.X / InCellSize); X <= FMath::FloorToInt32(Max.X / InCellSize); ++X)
+		{
+			for (int32 Y = FMath::FloorToInt32(Min.Y / InCellSize); Y <= FMath::FloorToInt32(Max.Y / InCellSize); ++Y)
+			{
+				CellMap.FindOrAdd(MakeCellKey(X, Y)).Add(uint32(LedgeIndex));
+			}
+		}
+	}
+	CellMap.KeySort(TLess<int64>());
+
+	TArray<FCell> CellRecords;
+	TArray<uint32> Indices;
+	for (const TPair<int64, TArray<uint32>>& Pair : CellMap)
+	{
+		FCell& Cell = CellRecords.AddZeroed_GetRef();
+		Cell.Key = Pair.Key;
+		Cell.FirstIndex = Indices.Num();
+		Cell.NumIndices = Pair.Value.Num();
+		Indices.Append(Pair.Value);
+	}
+
+	FHeader Header;
+	FMemory::Memzero(Header);
+	Header.Magic = Magic;
+	Header.Version = Version;
+	Header.CellSize = InCellSize;
+	Header.NumCells = CellRecords.Num();
+	Header.NumLedgeIndices = Indices.Num();
+	Header.NumLedges = Records.Num();
+	Header.CellsOffset = Align(sizeof(FHeader), alignof(FCell));
+	Header.IndicesOffset = Align(Header.CellsOffset + CellRecords.Num() * sizeof(FCell), alignof(uint32));
+	Header.LedgesOffset = Align(Header.IndicesOffset + Indices.Num() * sizeof(uint32), alignof(FLedge));
+
+	TArray<uint8> Bytes;
+	Bytes.SetNumZeroed(Header.LedgesOffset + Records.Num() * sizeof(FLedge));
+	FMemory::Memcpy(Bytes.GetData(), &Header, sizeof(Header));
+	FMemory::Memcpy(Bytes.GetData() + Header.CellsOffset, CellRecords.GetData(), CellRecords.Num() * sizeof(FCell));
+	FMemory::Memcpy(Bytes.GetData() + Header.IndicesOffset, Indices.GetData(), Indices.Num() * sizeof(uint32));
+	FMemory::Memcpy(Bytes.GetData() + Header.LedgesOffset, Records.GetData(), Records.Num() * sizeof(FLedge));
+
+	return FFileHelper::SaveArrayToFile(Bytes, *Filename);
+}
+#endif
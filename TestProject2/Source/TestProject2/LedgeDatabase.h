@@ -0,0 +1,134 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FClimbableLedge;
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/**
+ * 맵마다 쿠킹 전에 추출하는 바이너리 레지 데이터베이스 (<Content>/LedgeDatabase/<MapName>.tp2ledge).
+ * 파일은 읽기 전용으로 메모리 매핑되며, 아래 구조체가 그대로 파일 배치이므로 로드 시 파싱 단계가 없습니다.
+ * 모든 대상 플랫폼이 리틀 엔디언이라고 가정합니다.
+ *
+ *   FHeader | FCell[NumCells] (Key 오름차순) | uint32 LedgeIndices[NumLedgeIndices] | FLedge[NumLedges]
+ */
+namespace LedgeDatabase
+{
+	/** "TP2L" */
+	static constexpr uint32 Magic = 0x4C325054;
+
+	/** 배치가 바뀌면 올림 (버전이 다른 파일은 무시하고 런타임 레지스트리만 사용) */
+	static constexpr uint32 Version = 1;
+
+	struct FHeader
+	{
+		uint32 Magic;
+		uint32 Version;
+		float CellSize;
+		uint32 NumCells;
+		uint32 NumLedgeIndices;
+		uint32 NumLedges;
+		uint32 CellsOffset;
+		uint32 IndicesOffset;
+		uint32 LedgesOffset;
+		uint32 Reserved;
+	};
+
+	/** 격자 한 칸에 걸친 레지 인덱스 범위 */
+	struct FCell
+	{
+		int64 Key;
+		uint32 FirstIndex;
+		uint32 NumIndices;
+	};
+
+	/** 레지 모서리 하나 (윗면 높이 = Start.Z) */
+	struct FLedge
+	{
+		FVector3f Start;
+		FVector3f End;
+		FVector2f OutwardNormal;
+		/** 레지 윗면에서 위쪽 지오메트리까지의 여유 높이 (cm) */
+		float Clearance;
+		float Reserved;
+	};
+
+	static_assert(sizeof(FHeader) == 40, "Ledge database header layout changed, bump LedgeDatabase::Version");
+	static_assert(sizeof(FCell) == 16, "Ledge database cell layout changed, bump LedgeDatabase::Version");
+	static_assert(sizeof(FLedge) == 40, "Ledge database ledge layout changed, bump LedgeDatabase::Version");
+
+	FORCEINLINE int64 MakeCellKey(int32 X, int32 Y)
+	{
+		return (int64(X) << 32) | int64(uint32(Y));
+	}
+}
+
+/** 메모리 매핑된 레지 데이터베이스 (읽기 전용, 게임 스레드 / 워커 스레드 어디서든 조회 가능) */
+class TESTPROJECT2_API FLedgeDatabase
+{
+public:
+	~FLedgeDatabase();
+
+	/** 파일을 매핑하고 헤더 / 크기를 검증. 없거나 버전이 맞지 않으면 nullptr */
+	static TUniquePtr<FLedgeDatabase> Open(const FString& Filename);
+
+	/** 맵 이름 (/Game/.../ThirdPersonMap 또는 ThirdPersonMap) 에 해당하는 데이터베이스 파일 경로 */
+	static FString GetFilenameForMap(const FString& MapName);
+
+#if WITH_EDITOR
+	/** 레지와 여유 높이를 CellSize 격자로 색인하여 파일로 기록 */
+	static bool Write(const FString& Filename, TConstArrayView<FClimbableLedge> Ledges, TConstArrayView<float> Clearances, float CellSize);
+#endif
+
+	int32 GetNumLedges() const { return Ledges.Num(); }
+	int32 GetNumCells() const { return Cells.Num(); }
+	float GetCellSize() const { return CellSize; }
+	int64 GetSizeBytes() const { return SizeBytes; }
+
+	/** Center 주변 Radius 안의 칸에 걸친 레지마다 Func(const LedgeDatabase::FLedge&) 호출 (여러 칸에 걸친 레지는 중복될 수 있음) */
+	template <typename FuncType>
+	void ForEachLedgeNear(const FVector& Center, float Radius, FuncType&& Func) const
+	{
+		const int32 MinX = FMath::FloorToInt32((Center.X - Radius) / CellSize);
+		const int32 MaxX = FMath::FloorToInt32((Center.X + Radius) / CellSize);
+		const int32 MinY = FMath::FloorToInt32((Center.Y - Radius) / CellSize);
+		const int32 MaxY = FMath::FloorToInt32((Center.Y + Radius) / CellSize);
+
+		for (int32 X = MinX; X <= MaxX; ++X)
+		{
+			for (int32 Y = MinY; Y <= MaxY; ++Y)
+			{
+				if (const LedgeDatabase::FCell* Cell = FindCell(LedgeDatabase::MakeCellKey(X, Y)))
+				{
+					for (uint32 Index = Cell->FirstIndex; Index < Cell->FirstIndex + Cell->NumIndices; ++Index)
+					{
+						Func(Ledges[LedgeIndices[Index]]);
+					}
+				}
+			}
+		}
+	}
+
+private:
+	FLedgeDatabase() = default;
+
+	/** Data 위에 뷰를 만들고 범위를 검증 */
+	bool Bind(const uint8* Data, int64 Size);
+
+	const LedgeDatabase::FCell* FindCell(int64 Key) const;
+
+	TUniquePtr<IMappedFileHandle> MappedHandle;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+
+	/** 매핑을 지원하지 않는 파일 시스템 (pak 등) 에서 읽어 둔 사본 */
+	TArray64<uint8> FallbackData;
+
+	TConstArrayView<LedgeDatabase::FCell> Cells;
+	TConstArrayView<uint32> LedgeIndices;
+	TConstArrayView<LedgeDatabase::FLedge> Ledges;
+	float CellSize = 1.0f;
+	int64 SizeBytes = 0;
+};
@@ -0,0 +1,256 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LedgeQueryComponent.h"
+#include "ClimbableSubsystem.h"
+#include "TestProject2.h"
+#include "Components/CapsuleComponent.h"
+#include "GameFramework/Character.h"
+#include "Engine/World.h"
+
+namespace LedgeQuery
+{
+	/** 이 거리 / 각도 이상 움직이면 새 프로브를 발행 */
+	constexpr float MoveTolerance = 1.0f;
+	constexpr float ForwardDotTolerance = 0.9998f;
+
+	/** 시야 프로브 끝점을 레지 모서리에서 바깥 / 위로 띄울 거리 (모서리 자체에 닿지 않도록) */
+	constexpr float EdgeViewOffset = 10.0f;
+
+	/** 최근 결과를 그대로 쓸 수 있는 프로브 위치와의 거리 (결과는 발행 다음 프레임에 수집되므로 이동 중에는 한두 프레임 이동량만큼 어긋남) */
+	constexpr float CurrentResultTolerance = 20.0f;
+
+	static const FHitResult* FindBlockingHit(const TArray<FHitResult>& Hits)
+	{
+		for (const FHitResult& Hit : Hits)
+		{
+			if (Hit.bBlockingHit)
+			{
+				return &Hit;
+			}
+		}
+		return nullptr;
+	}
+}
+
+ULedgeQueryComponent::ULedgeQueryComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.TickGroup = TG_PrePhysics;
+
+	MinMantleHeight = 50.0f;
+	MaxMantleHeight = 250.0f;
+	LedgeInset = 50.0f;
+	MaxSurfaceMismatch = 10.0f;
+	MantleFloorOffset = 2.0f;
+	TraceChannel = ECC_Visibility;
+
+	TraceOffset = FVector::ZeroVector;
+	TraceDistance = 150.0f;
+	PendingCapsuleHalfHeight = 0.0f;
+	ProbeIntervalFrames = 1;
+	bProbeRequested = false;
+}
+
+void ULedgeQueryComponent::SetProbeShape(const FVector& InTraceOffset, float InTraceDistance)
+{
+	TraceOffset = InTraceOffset;
+	TraceDistance = InTraceDistance;
+}
+
+bool ULedgeQueryComponent::IsLatestResultCurrent() const
+{
+	if (LatestResult.IssuedFrame == 0)
+	{
+		return false;
+	}
+	return GFrameCounter - LatestResult.IssuedFrame <= 1 || !HasMovedSince(LatestResult, LedgeQuery::CurrentResultTolerance);
+}
+
+bool ULedgeQueryComponent::IsValidMantleTarget(const FVector& TargetLocation, float Tolerance) const
+{
+	const ACharacter* Character = GetOwner<ACharacter>();
+	const UClimbableSubsystem* Climbables = UWorld::GetSubsystem<UClimbableSubsystem>(GetWorld());
+	if (Character == nullptr || Climbables == nullptr)
+	{
+		return false;
+	}
+
+	const float HalfHeight = Character->GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
+	const FVector Feet = Character->GetActorLocation() - FVector(0.0f, 0.0f, HalfHeight);
+
+	// 목표 쪽으로 조회 (클라이언트가 조회한 뒤 회전이 조금 달라졌어도 같은 레지를 찾도록)
+	FClimbableLedgeHit Ledge;
+	if (!Climbables->FindLedgeInFront(Feet, (TargetLocation - Feet).GetSafeNormal2D(), TraceOffset.X + TraceDistance + Tolerance,
+		MinMantleHeight - Tolerance, MaxMantleHeight + Tolerance, Ledge))
+	{
+		return false;
+	}
+
+	// IssueProbes 의 목표: 모서리에서 LedgeInset 안쪽, 윗면 위에 캡슐 (여유 공간 프로브가 MaxSurfaceMismatch 까지 높이를 바꿈)
+	const FVector FromEdge = TargetLocation - Ledge.ClosestPoint;
+	const float Inset = FVector::DotProduct(FromEdge, -Ledge.OutwardNormal);
+	const float Lateral = FMath::Sqrt(FMath::Max(FromEdge.SizeSquared2D() - FMath::Square(Inset), 0.0f));
+	const float ExpectedZ = Ledge.ClosestPoint.Z + HalfHeight + MantleFloorOffset;
+
+	if (FMath::Abs(Inset - LedgeInset) > Tolerance || Lateral > Tolerance || FMath::Abs(TargetLocation.Z - ExpectedZ) > MaxSurfaceMismatch + Tolerance)
+	{
+		return false;
+	}
+
+	// IssueProbes 의 시야 프로브와 같은 조건 (요청 한 번에 트레이스 한 번)
+	const FCollisionQueryParams Params(SCENE_QUERY_STAT(LedgeQueryValidate), false, Character);
+	const FVector EdgeView = Ledge.ClosestPoint + Ledge.OutwardNormal * LedgeQuery::EdgeViewOffset + FVector(0.0f, 0.0f, LedgeQuery::EdgeViewOffset);
+	return !GetWorld()->LineTraceTestByChannel(Character->GetActorLocation(), EdgeView, TraceChannel, Params);
+}
+
+bool ULedgeQueryComponent::HasMovedSince(const FLedgeQueryResult& Probe, float Tolerance) const
+{
+	const AActor* Owner = GetOwner();
+	if (Probe.IssuedFrame == 0 || Owner == nullptr)
+	{
+		return true;
+	}
+
+	const FVector Forward = Owner->GetActorForwardVector().GetSafeNormal2D();
+	return FVector::DistSquared(Owner->GetActorLocation(), Probe.ProbeOrigin) > FMath::Square(Tolerance)
+		|| FVector::DotProduct(Forward, Probe.ProbeForward) < LedgeQuery::ForwardDotTolerance;
+}
+
+void ULedgeQueryComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	CollectProbes();
+
+	// 움직이는 동안에만 ProbeIntervalFrames 마다 새로 조회 (정지 중에는 마지막 결과가 그대로 유효)
+	const bool bIntervalElapsed = GFrameCounter - PendingProbe.IssuedFrame >= static_cast<uint64>(ProbeIntervalFrames);
+	if (bProbeRequested || (bIntervalElapsed && HasMovedSince(PendingProbe, LedgeQuery::MoveTolerance)))
+	{
+		IssueProbes();
+	}
+}
+
+void ULedgeQueryComponent::IssueProbes()
+{
+	TP2_SCOPE_CYCLE_COUNTER(STAT_TP2_LedgeQueryIssue);
+
+	ACharacter* Character = GetOwner<ACharacter>();
+	UWorld* World = GetWorld();
+	const UClimbableSubsystem* Climbables = UWorld::GetSubsystem<UClimbableSubsystem>(World);
+
+	// 조회할 수 없어도 요청은 소비 (남아 있으면 매 틱 다시 발행하려 하고 대기 중인 TryClimb 이 끝나지 않음)
+	bProbeRequested = false;
+	ClearanceProbeHandle = FTraceHandle();
+	VisibilityProbeHandle = FTraceHandle();
+	if (Character == nullptr)
+	{
+		return;
+	}
+
+	const UCapsuleComponent* Capsule = Character->GetCapsuleComponent();
+	const float HalfHeight = Capsule->GetScaledCapsuleHalfHeight();
+	const float Radius = Capsule->GetScaledCapsuleRadius();
+
+	const FVector Origin = Character->GetActorLocation();
+	const FVector Forward = Character->GetActorForwardVector().GetSafeNormal2D();
+	const FVector Feet = Origin - FVector(0.0f, 0.0f, HalfHeight);
+
+	PendingProbe = FLedgeQueryResult();
+	PendingProbe.IssuedFrame = GFrameCounter;
+	PendingProbe.ProbeOrigin = Origin;
+	PendingProbe.ProbeForward = Forward;
+	PendingCapsuleHalfHeight = HalfHeight;
+
+	// 레지 레지스트리가 없는 월드: "레지 없음" 으로 확정
+	if (Climbables == nullptr)
+	{
+		PublishResult(PendingProbe);
+		return;
+	}
+
+	// 1) 레지 레지스트리 조회: 물리 트레이스와 태그 검사 없이 전방 레지 모서리와 높이를 얻음
+	FClimbableLedgeHit Ledge;
+	if (!Climbables->FindLedgeInFront(Feet, Forward, TraceOffset.X + TraceDistance, MinMantleHeight, MaxMantleHeight, Ledge))
+	{
+		// 앞에 레지가 없으면 프로브 없이 바로 결과 확정
+		PublishResult(PendingProbe);
+		return;
+	}
+
+	PendingProbe.WallImpactPoint = Ledge.ClosestPoint;
+	PendingProbe.WallNormal = Ledge.OutwardNormal;
+	PendingProbe.LedgeTopPoint = Ledge.ClosestPoint - Ledge.OutwardNormal * LedgeInset;
+	PendingProbe.MantleHeight = Ledge.Height;
+	PendingProbe.LedgeActor = Ledge.Owner;
+
+	// 2) 시야 프로브: 레지스트리는 벽을 모르므로 캐릭터 중심에서 모서리 바로 바깥 위 지점까지 막힌 것이 없어야 함 (벽 너머 레지 제외)
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(LedgeQuery), false, Character);
+	const FVector EdgeView = Ledge.ClosestPoint + Ledge.OutwardNormal * LedgeQuery::EdgeViewOffset + FVector(0.0f, 0.0f, LedgeQuery::EdgeViewOffset);
+	VisibilityProbeHandle = World->AsyncLineTraceByChannel(EAsyncTraceType::Single, Origin, EdgeView, TraceChannel, Params);
+
+	// 데이터베이스 레지는 여유 높이가 미리 계산되어 있으므로 캡슐이 들어가면 여유 공간 프로브 없이 시야만 확인
+	if (Ledge.Clearance >= 2.0f * HalfHeight + MantleFloorOffset)
+	{
+		PendingProbe.MantleTargetLocation = PendingProbe.LedgeTopPoint + FVector(0.0f, 0.0f, HalfHeight + MantleFloorOffset);
+		PendingProbe.bIsClimbable = true;
+		return;
+	}
+
+	// 3) 여유 공간 프로브: 레지 안쪽 지점에서 캡슐을 레지 높이 근처로 내려 설 수 있는지 확인
+	const FVector SweepStart = PendingProbe.LedgeTopPoint + FVector(0.0f, 0.0f, HalfHeight + MaxSurfaceMismatch);
+	const FVector SweepEnd = PendingProbe.LedgeTopPoint + FVector(0.0f, 0.0f, HalfHeight - MaxSurfaceMismatch);
+	ClearanceProbeHandle = World->AsyncSweepByChannel(EAsyncTraceType::Single, SweepStart, SweepEnd, FQuat::Identity, TraceChannel,
+		FCollisionShape::MakeCapsule(Radius, HalfHeight), Params);
+}
+
+void ULedgeQueryComponent::CollectProbes()
+{
+	if (!VisibilityProbeHandle.IsValid())
+	{
+		return;
+	}
+
+	TP2_SCOPE_CYCLE_COUNTER(STAT_TP2_LedgeQueryCollect);
+
+	UWorld* World = GetWorld();
+	const bool bHasClearanceProbe = ClearanceProbeHandle.IsValid();
+	FTraceDatum VisibilityData;
+	FTraceDatum ClearanceData;
+	const bool bReady = World->QueryTraceData(VisibilityProbeHandle, VisibilityData)
+		&& (!bHasClearanceProbe || World->QueryTraceData(ClearanceProbeHandle, ClearanceData));
+	VisibilityProbeHandle = FTraceHandle();
+	ClearanceProbeHandle = FTraceHandle();
+
+	if (!bReady)
+	{
+		// 틱이 한 프레임 이상 건너뛰어 결과가 만료됨. 다음 틱에 다시 발행
+		bProbeRequested = true;
+		return;
+	}
+
+	FLedgeQueryResult Result = PendingProbe;
+	if (bHasClearanceProbe)
+	{
+		const FHitResult* ClearanceHit = LedgeQuery::FindBlockingHit(ClearanceData.OutHits);
+		if (ClearanceHit && !ClearanceHit->bStartPenetrating)
+		{
+			const float RestingSurfaceZ = ClearanceHit->Location.Z - PendingCapsuleHalfHeight;
+			Result.MantleTargetLocation = ClearanceHit->Location + FVector(0.0f, 0.0f, MantleFloorOffset);
+			Result.bIsClimbable = FMath::Abs(RestingSurfaceZ - Result.LedgeTopPoint.Z) <= MaxSurfaceMismatch;
+		}
+	}
+
+	// 모서리까지 막힌 것이 있으면 (벽 너머 / 위층 레지) 올라갈 수 없음
+	if (LedgeQuery::FindBlockingHit(VisibilityData.OutHits))
+	{
+		Result.bIsClimbable = false;
+	}
+
+	PublishResult(Result);
+}
+
+void ULedgeQueryComponent::PublishResult(const FLedgeQueryResult& Result)
+{
+	LatestResult = Result;
+	OnLedgeQueryUpdated.Broadcast(LatestResult);
+}
@@ -0,0 +1,149 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "WorldCollision.h"
+#include "LedgeQueryComponent.generated.h"
+
+/** 레지 쿼리 한 번의 결과 (레지 레지스트리 조회 + 시야 / 캡슐 여유 공간 프로브를 합친 값) */
+USTRUCT(BlueprintType)
+struct FLedgeQueryResult
+{
+	GENERATED_BODY()
+
+	/** 레지가 있고 시야 / 여유 공간 프로브를 통과하여 올라갈 수 있는지 */
+	UPROPERTY(BlueprintReadOnly, Category = "Ledge")
+	bool bIsClimbable = false;
+
+	/** 레지 모서리 위에서 캐릭터에 가장 가까운 점 */
+	UPROPERTY(BlueprintReadOnly, Category = "Ledge")
+	FVector WallImpactPoint = FVector::ZeroVector;
+
+	/** 벽면 바깥쪽 노멀 */
+	UPROPERTY(BlueprintReadOnly, Category = "Ledge")
+	FVector WallNormal = FVector::ZeroVector;
+
+	/** 여유 공간 프로브를 찍은 레지 윗면 지점 */
+	UPROPERTY(BlueprintReadOnly, Category = "Ledge")
+	FVector LedgeTopPoint = FVector::ZeroVector;
+
+	/** 캡슐이 레지 위에 섰을 때의 캡슐 중심 위치 (올라가기 목표 위치) */
+	UPROPERTY(BlueprintReadOnly, Category = "Ledge")
+	FVector MantleTargetLocation = FVector::ZeroVector;
+
+	/** 캐릭터 발바닥 기준 레지 높이 */
+	UPROPERTY(BlueprintReadOnly, Category = "Ledge")
+	float MantleHeight = 0.0f;
+
+	/** 레지를 등록한 액터 */
+	TWeakObjectPtr<AActor> LedgeActor;
+
+	/** 프로브를 발행한 프레임 번호 (GFrameCounter) */
+	uint64 IssuedFrame = 0;
+
+	/** 프로브를 발행할 때의 캐릭터 위치 */
+	FVector ProbeOrigin = FVector::ZeroVector;
+
+	/** 프로브를 발행할 때의 캐릭터 전방 벡터 (수평) */
+	FVector ProbeForward = FVector::ForwardVector;
+};
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnLedgeQueryUpdated, const FLedgeQueryResult& /*Result*/);
+
+/**
+ * 캐릭터가 움직이는 동안 매 프레임 전방 레지를 미리 조회합니다.
+ * 레지 위치와 높이는 UClimbableSubsystem 의 공간 해시에서 찾고, 그 위에 캡슐이 설 수 있는지만 비동기 스윕으로 확인합니다.
+ * 스윕 결과는 다음 프레임에 수집되므로, 입력 시점에는 최대 한 프레임 전의 결과를 게임 스레드 대기 없이 읽을 수 있습니다.
+ */
+UCLASS(ClassGroup = (Climbing), meta = (BlueprintSpawnableComponent))
+class TESTPROJECT2_API ULedgeQueryComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	ULedgeQueryComponent();
+
+	/** 전방 조회 시작 오프셋 (캐릭터 기준, X = 전방) 과 조회 거리 설정 */
+	void SetProbeShape(const FVector& InTraceOffset, float InTraceDistance);
+
+	/** 가장 최근에 수집된 결과 */
+	const FLedgeQueryResult& GetLatestResult() const { return LatestResult; }
+
+	/** 최근 결과를 지금 그대로 쓸 수 있는지 (직전 프레임에 발행되었거나, 그 뒤로 캐릭터가 거의 움직이지 않음) */
+	bool IsLatestResultCurrent() const;
+
+	/** 움직이는 동안 프로브를 발행할 간격 (프레임, 중요도가 낮은 캐릭터일수록 크게) */
+	void SetProbeIntervalFrames(int32 InIntervalFrames) { ProbeIntervalFrames = FMath::Max(InIntervalFrames, 1); }
+
+	/**
+	 * TargetLocation 이 현재 위치에서 이 컴포넌트가 계산했을 올라가기 목표와 Tolerance 안에서 일치하는지 레지 레지스트리로 확인.
+	 * 서버가 원격 클라이언트의 올라가기 요청을 검증할 때 사용 (시야는 동기 트레이스로 확인, 여유 공간 프로브는 하지 않음)
+	 */
+	bool IsValidMantleTarget(const FVector& TargetLocation, float Tolerance) const;
+
+	/** 이동 여부와 관계없이 이번 프레임에 프로브를 발행하도록 요청 */
+	void RequestProbe() { bProbeRequested = true; }
+
+	/** 새 결과가 수집될 때마다 호출됩니다. */
+	FOnLedgeQueryUpdated OnLedgeQueryUpdated;
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+protected:
+	/** 발바닥 기준 올라갈 수 있는 최소 레지 높이 */
+	UPROPERTY(EditDefaultsOnly, Category = "Ledge")
+	float MinMantleHeight;
+
+	/** 발바닥 기준 올라갈 수 있는 최대 레지 높이 */
+	UPROPERTY(EditDefaultsOnly, Category = "Ledge")
+	float MaxMantleHeight;
+
+	/** 레지 모서리에서 안쪽으로 여유 공간 프로브를 찍을 거리 */
+	UPROPERTY(EditDefaultsOnly, Category = "Ledge")
+	float LedgeInset;
+
+	/** 레지 높이와 캡슐 스윕이 닿은 높이의 허용 오차 (레지 위에 다른 물체가 있는 경우 제외) */
+	UPROPERTY(EditDefaultsOnly, Category = "Ledge")
+	float MaxSurfaceMismatch;
+
+	/** 목표 위치를 레지 윗면에서 띄울 거리 (바닥 판정용 여유) */
+	UPROPERTY(EditDefaultsOnly, Category = "Ledge")
+	float MantleFloorOffset;
+
+	/** 프로브에 사용할 콜리전 채널 */
+	UPROPERTY(EditDefaultsOnly, Category = "Ledge")
+	TEnumAsByte<ECollisionChannel> TraceChannel;
+
+private:
+	/** 지난 프레임에 발행한 시야 / 여유 공간 프로브 결과를 수집 */
+	void CollectProbes();
+
+	/** 현재 캐릭터 위치에서 레지를 조회하고 시야 / 여유 공간 프로브를 발행 */
+	void IssueProbes();
+
+	/** 결과를 확정하여 LatestResult 로 옮기고 알림 */
+	void PublishResult(const FLedgeQueryResult& Result);
+
+	/** 주어진 프로브 위치에서 캐릭터가 Tolerance 이상 움직였거나 방향을 바꿨는지 */
+	bool HasMovedSince(const FLedgeQueryResult& Probe, float Tolerance) const;
+
+	FVector TraceOffset;
+	float TraceDistance;
+
+	FTraceHandle ClearanceProbeHandle;
+
+	/** 캐릭터에서 레지 모서리까지 시야 프로브 (레지가 발견되면 항상 발행) */
+	FTraceHandle VisibilityProbeHandle;
+
+	/** 발행 중인 프로브의 메타데이터 (결과 수집 시 LatestResult로 옮겨짐) */
+	FLedgeQueryResult PendingProbe;
+	float PendingCapsuleHalfHeight;
+
+	FLedgeQueryResult LatestResult;
+
+	int32 ProbeIntervalFrames;
+
+	bool bProbeRequested;
+};
@@ -0,0 +1,178 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "MusicSubsystem.h"
+#include "TestProject2.h"
+#include "TimeDilationSubsystem.h"
+#include "AudioModulationStatics.h"
+#include "Components/AudioComponent.h"
+#include "Engine/AssetManager.h"
+#include "Engine/World.h"
+#include "Kismet/GameplayStatics.h"
+#include "SoundControlBus.h"
+
+bool UMusicSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	return Super::ShouldCreateSubsystem(Outer) && !IsRunningDedicatedServer();
+}
+
+void UMusicSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// BGM 과 버스는 게임 시작 시 비동기로 로드하고 첫 청크를 스트리밍 캐시에 올려둠
+	TArray<FSoftObjectPath> Assets;
+	for (const FSoftObjectPath& Path : { Music.ToSoftObjectPath(), VolumeBus.ToSoftObjectPath(), PitchBus.ToSoftObjectPath() })
+	{
+		if (!Path.IsNull())
+		{
+			Assets.Add(Path);
+		}
+	}
+
+	if (Assets.Num() > 0)
+	{
+		LoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(Assets, FStreamableDelegate::CreateUObject(this, &UMusicSubsystem::OnMusicLoaded));
+	}
+
+	WorldInitializedHandle = FWorldDelegates::OnWorldInitializedActors.AddUObject(this, &UMusicSubsystem::OnWorldInitializedActors);
+}
+
+void UMusicSubsystem::OnWorldInitializedActors(const FActorsInitializedParams& Params)
+{
+	UWorld* World = Params.World;
+	if (World && World->IsGameWorld() && World->GetGameInstance() == GetGameInstance())
+	{
+		StartMusic(World);
+	}
+}
+
+void UMusicSubsystem::Deinitialize()
+{
+	FWorldDelegates::OnWorldInitializedActors.Remove(WorldInitializedHandle);
+	StopMusic();
+
+	if (LoadHandle.IsValid())
+	{
+		LoadHandle->CancelHandle();
+		LoadHandle.Reset();
+	}
+
+	Super::Deinitialize();
+}
+
+void UMusicSubsystem::OnMusicLoaded()
+{
+	LoadedVolumeBus = VolumeBus.Get();
+	LoadedPitchBus = PitchBus.Get();
+
+	if (USoundBase* Sound = Music.Get())
+	{
+		UGameplayStatics::PrimeSound(Sound);
+	}
+
+	if (UWorld* World = PendingWorld.Get())
+	{
+		PendingWorld.Reset();
+		StartMusic(World);
+	}
+}
+
+void UMusicSubsystem::StartMusic(UWorld* World)
+{
+	if (World == nullptr)
+	{
+		return;
+	}
+
+	if (LoadHandle.IsValid() && LoadHandle->IsLoadingInProgress())
+	{
+		PendingWorld = World;
+		return;
+	}
+
+	USoundBase* Sound = Music.Get();
+	if (Sound == nullptr)
+	{
+		UE_LOG(LogTestProject2, Warning, TEXT("UMusicSubsystem: Music is not set or failed to load. BGM will not play."));
+		return;
+	}
+
+	if (MusicComponent == nullptr || !MusicComponent->IsPlaying())
+	{
+		// 2D, 레벨 전환 후에도 유지, 자동 파괴 안 함
+		MusicComponent = UGameplayStatics::CreateSound2D(World, Sound, 1.0f, 1.0f, 0.0f, nullptr, true, false);
+		if (MusicComponent == nullptr)
+		{
+			return;
+		}
+
+		if (LoadedVolumeBus)
+		{
+			MusicComponent->SetModulationRouting(TSet<USoundModulatorBase*>{ LoadedVolumeBus.Get() }, EModulationDestination::Volume, EModulationRouting::Union);
+		}
+		if (LoadedPitchBus)
+		{
+			MusicComponent->SetModulationRouting(TSet<USoundModulatorBase*>{ LoadedPitchBus.Get() }, EModulationDestination::Pitch, EModulationRouting::Union);
+		}
+		MusicComponent->Play();
+	}
+
+	// 새 월드의 슬로우 모션 가중치 구독 (이전 월드는 함께 사라짐)
+	if (ListeningWorld.Get() != World)
+	{
+		if (UTimeDilationSubsystem* PreviousTimeDilation = UWorld::GetSubsystem<UTimeDilationSubsystem>(ListeningWorld.Get()))
+		{
+			PreviousTimeDilation->OnSlowMotionWeightChanged.Remove(SlowMotionHandle);
+		}
+
+		ListeningWorld = World;
+		if (UTimeDilationSubsystem* TimeDilation = World->GetSubsystem<UTimeDilationSubsystem>())
+		{
+			SlowMotionHandle = TimeDilation->OnSlowMotionWeightChanged.AddUObject(this, &UMusicSubsystem::OnSlowMotionWeightChanged);
+			OnSlowMotionWeightChanged(TimeDilation->GetSlowMotionWeight());
+		}
+	}
+}
+
+void UMusicSubsystem::StopMusic()
+{
+	if (UTimeDilationSubsystem* TimeDilation = UWorld::GetSubsystem<UTimeDilationSubsystem>(ListeningWorld.Get()))
+	{
+		TimeDilation->OnSlowMotionWeightChanged.Remove(SlowMotionHandle);
+	}
+	ListeningWorld.Reset();
+	SlowMotionHandle.Reset();
+
+	if (MusicComponent)
+	{
+		MusicComponent->Stop();
+		MusicComponent->DestroyComponent();
+		MusicComponent = nullptr;
+	}
+}
+
+void UMusicSubsystem::OnSlowMotionWeightChanged(float Weight)
+{
+	const float Volume = FMath::Lerp(1.0f, SlowMotionVolume, Weight);
+	const float Pitch = FMath::Lerp(1.0f, SlowMotionPitch, Weight);
+	UWorld* World = ListeningWorld.Get();
+
+	// 버스가 있으면 값 하나만 바꿈 (라우팅된 모든 사운드에 적용)
+	if (LoadedVolumeBus)
+	{
+		UAudioModulationStatics::SetGlobalBusMixValue(World, LoadedVolumeBus, Volume);
+	}
+	else if (MusicComponent)
+	{
+		MusicComponent->SetVolumeMultiplier(Volume);
+	}
+
+	if (LoadedPitchBus)
+	{
+		UAudioModulationStatics::SetGlobalBusMixValue(World, LoadedPitchBus, Pitch);
+	}
+	else if (MusicComponent)
+	{
+		MusicComponent->SetPitchMultiplier(Pitch);
+	}
+}
@@ -0,0 +1,80 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "MusicSubsystem.generated.h"
+
+class UAudioComponent;
+class USoundBase;
+class USoundControlBus;
+struct FStreamableHandle;
+
+/**
+ * 게임 인스턴스 전체에서 BGM 음성 하나만 재생합니다 (레벨 전환 후에도 유지).
+ * 슬로우 모션 동안의 볼륨 / 피치는 Audio Modulation 컨트롤 버스 값 하나로 조절하므로,
+ * 같은 버스로 라우팅된 모든 사운드에 컴포넌트 수정 없이 적용됩니다.
+ */
+UCLASS(config = Game)
+class TESTPROJECT2_API UMusicSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** World 에서 BGM 을 재생 (이미 재생 중이면 유지) 하고, 그 월드의 슬로우 모션 가중치를 구독 */
+	void StartMusic(UWorld* World);
+
+	/** BGM 정지 */
+	void StopMusic();
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+protected:
+	/** 재생할 BGM (SC_InGameBGM). 스트리밍 캐시 크기는 플랫폼 설정의 CacheSizeKB */
+	UPROPERTY(config)
+	TSoftObjectPtr<USoundBase> Music;
+
+	/** 슬로우 모션 볼륨 / 피치를 적용할 컨트롤 버스 (없으면 BGM 컴포넌트에 직접 적용) */
+	UPROPERTY(config)
+	TSoftObjectPtr<USoundControlBus> VolumeBus;
+
+	UPROPERTY(config)
+	TSoftObjectPtr<USoundControlBus> PitchBus;
+
+	/** 슬로우 모션 시 목표 볼륨 / 피치 */
+	UPROPERTY(config)
+	float SlowMotionVolume = 0.5f;
+
+	UPROPERTY(config)
+	float SlowMotionPitch = 1.0f;
+
+private:
+	/** 이 게임 인스턴스의 게임 월드가 액터 초기화를 마치면 BGM 재생 (클라이언트 포함) */
+	void OnWorldInitializedActors(const FActorsInitializedParams& Params);
+
+	void OnMusicLoaded();
+	void OnSlowMotionWeightChanged(float Weight);
+
+	UPROPERTY(Transient)
+	TObjectPtr<UAudioComponent> MusicComponent;
+
+	UPROPERTY(Transient)
+	TObjectPtr<USoundControlBus> LoadedVolumeBus;
+
+	UPROPERTY(Transient)
+	TObjectPtr<USoundControlBus> LoadedPitchBus;
+
+	TSharedPtr<FStreamableHandle> LoadHandle;
+
+	/** 로드가 끝나면 재생할 월드 */
+	TWeakObjectPtr<UWorld> PendingWorld;
+
+	/** 슬로우 모션 가중치를 구독 중인 월드 */
+	TWeakObjectPtr<UWorld> ListeningWorld;
+	FDelegateHandle SlowMotionHandle;
+
+	FDelegateHandle WorldInitializedHandle;
+};
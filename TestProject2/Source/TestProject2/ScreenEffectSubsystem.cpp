@@ -0,0 +1,97 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ScreenEffectSubsystem.h"
+#include "Components/PostProcessComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Materials/MaterialInterface.h"
+
+bool UScreenEffectSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	return Super::ShouldCreateSubsystem(Outer) && !IsRunningDedicatedServer();
+}
+
+void UScreenEffectSubsystem::Deinitialize()
+{
+	Layers.Empty();
+	LayerOwner = nullptr;
+
+	Super::Deinitialize();
+}
+
+UPostProcessComponent* UScreenEffectSubsystem::CreateLayerComponent(FName Name, float Priority)
+{
+	UWorld* World = GetWorld();
+	if (World == nullptr || !World->IsGameWorld())
+	{
+		return nullptr;
+	}
+
+	if (LayerOwner == nullptr)
+	{
+		FActorSpawnParameters Params;
+		Params.Name = TEXT("ScreenEffectLayers");
+		Params.NameMode = FActorSpawnParameters::ESpawnActorNameMode::Requested;
+		Params.ObjectFlags |= RF_Transient;
+		LayerOwner = World->SpawnActor<AActor>(Params);
+		if (LayerOwner == nullptr)
+		{
+			return nullptr;
+		}
+	}
+
+	UPostProcessComponent* Layer = NewObject<UPostProcessComponent>(LayerOwner, Name);
+	Layer->bUnbound = true;
+	Layer->Priority = Priority;
+	Layer->BlendWeight = 0.0f;
+	Layer->bEnabled = false;
+	Layer->RegisterComponent();
+
+	Layers.Add(Name, Layer);
+	return Layer;
+}
+
+void UScreenEffectSubsystem::RegisterLayer(FName Name, const FPostProcessSettings& Settings, float Priority)
+{
+	if (Layers.Contains(Name))
+	{
+		return;
+	}
+
+	if (UPostProcessComponent* Layer = CreateLayerComponent(Name, Priority))
+	{
+		Layer->Settings = Settings;
+	}
+}
+
+void UScreenEffectSubsystem::RegisterMaterialLayer(FName Name, UMaterialInterface* Material, float Priority)
+{
+	if (Layers.Contains(Name) || Material == nullptr)
+	{
+		return;
+	}
+
+	if (UPostProcessComponent* Layer = CreateLayerComponent(Name, Priority))
+	{
+		Layer->Settings.WeightedBlendables.Array.Add(FWeightedBlendable(1.0f, Material));
+	}
+}
+
+void UScreenEffectSubsystem::SetLayerWeight(FName Name, float Weight)
+{
+	UPostProcessComponent* Layer = Layers.FindRef(Name);
+	if (Layer == nullptr || Layer->BlendWeight == Weight)
+	{
+		return;
+	}
+
+	// 스칼라 하나만 바꿈 (뷰가 매 프레임 후처리 볼륨을 모을 때 읽음). 0 이면 모으는 대상에서 제외
+	Layer->BlendWeight = Weight;
+	Layer->bEnabled = Weight > 0.0f;
+}
+
+float UScreenEffectSubsystem::GetLayerWeight(FName Name) const
+{
+	const UPostProcessComponent* Layer = Layers.FindRef(Name);
+	return Layer ? Layer->BlendWeight : 0.0f;
+}
@@ -0,0 +1,51 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/Scene.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ScreenEffectSubsystem.generated.h"
+
+class UPostProcessComponent;
+
+/**
+ * 전체 화면 효과 (슬로우 모션 흑백화, 피격 플래시, 데미지 비네트 등) 를 이름 있는 후처리 레이어로 관리합니다.
+ * 레이어마다 언바운드 UPostProcessComponent 하나를 두고 설정은 등록 시 한 번만 적용하며,
+ * 이후 전환은 BlendWeight 스칼라 하나만 바꿉니다. 가중치가 0 인 레이어는 꺼져 있어 비용이 없습니다.
+ */
+UCLASS()
+class TESTPROJECT2_API UScreenEffectSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Name 레이어를 등록 (이미 있으면 그대로 둠). Settings 의 bOverride_* 로 켠 항목만 섞임 */
+	void RegisterLayer(FName Name, const FPostProcessSettings& Settings, float Priority = 0.0f);
+
+	/** Name 레이어의 머티리얼 블렌더블 (비네트 / 플래시용 후처리 머티리얼) 을 등록 */
+	void RegisterMaterialLayer(FName Name, UMaterialInterface* Material, float Priority = 0.0f);
+
+	/** 레이어 가중치 설정 (0.0 ~ 1.0) */
+	void SetLayerWeight(FName Name, float Weight);
+
+	float GetLayerWeight(FName Name) const;
+
+	bool HasLayer(FName Name) const { return Layers.Contains(Name); }
+
+	/** 등록된 모든 레이어 이름 */
+	void GetLayerNames(TArray<FName>& OutNames) const { Layers.GenerateKeyArray(OutNames); }
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+private:
+	UPostProcessComponent* CreateLayerComponent(FName Name, float Priority);
+
+	/** 레이어 컴포넌트를 붙일 액터 (처음 레이어를 등록할 때 생성) */
+	UPROPERTY(Transient)
+	TObjectPtr<AActor> LayerOwner;
+
+	UPROPERTY(Transient)
+	TMap<FName, TObjectPtr<UPostProcessComponent>> Layers;
+};
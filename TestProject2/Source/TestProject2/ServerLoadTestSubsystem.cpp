@@ -0,0 +1,333 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ServerLoadTestSubsystem.h"
+#include "TestProject2.h"
+#include "TestProject2Character.h"
+#include "Engine/NetDriver.h"
+#include "Engine/World.h"
+#include "GameFramework/GameModeBase.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectArray.h"
+
+static FAutoConsoleCommandWithWorldAndArgs CmdServerLoadTest(
+	TEXT("TestProject2.Server.LoadTest"),
+	TEXT("봇을 스폰하여 서버 부하를 측정합니다. 인자: <Bots> [Seconds]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (UServerLoadTestSubsystem* Subsystem = UWorld::GetSubsystem<UServerLoadTestSubsystem>(World))
+		{
+			const int32 NumBots = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 32;
+			const float Seconds = Args.Num() > 1 ? FCString::Atof(*Args[1]) : 60.0f;
+			Subsystem->StartLoadTest(NumBots, Seconds);
+		}
+	}));
+
+namespace ServerLoadTest
+{
+	/** 봇을 스폰하기 전 기준 프레임 측정 시간 / 스폰 후 안정화 시간 (실제 시간, 초) */
+	constexpr double BaselineSeconds = 10.0;
+	constexpr double SettleSeconds = 5.0;
+
+	/** 봇을 흩어 놓을 플레이어 스타트 주변 반경 */
+	constexpr float SpawnRadius = 2000.0f;
+
+	/** 봇이 방향 / 행동을 바꾸는 간격 (초) */
+	constexpr float MinDecisionSeconds = 1.0f;
+	constexpr float MaxDecisionSeconds = 4.0f;
+
+	/** 결정할 때마다 점프 / 올라가기를 시도할 확률 */
+	constexpr float JumpChance = 0.2f;
+	constexpr float ClimbChance = 0.2f;
+}
+
+float UServerLoadTestSubsystem::FFrameSamples::Average(const TArray<float>& Samples)
+{
+	double Sum = 0.0;
+	for (const float Sample : Samples)
+	{
+		Sum += Sample;
+	}
+	return Samples.Num() > 0 ? float(Sum / Samples.Num()) : 0.0f;
+}
+
+float UServerLoadTestSubsystem::FFrameSamples::Percentile(TArray<float> Samples, float Percent)
+{
+	if (Samples.Num() == 0)
+	{
+		return 0.0f;
+	}
+	Samples.Sort();
+	return Samples[FMath::Min(Samples.Num() - 1, FMath::FloorToInt32(Percent * Samples.Num()))];
+}
+
+bool UServerLoadTestSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+#if UE_BUILD_SHIPPING
+	return false;
+#else
+	return Super::ShouldCreateSubsystem(Outer);
+#endif
+}
+
+bool UServerLoadTestSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UServerLoadTestSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	PreActorTickHandle = FWorldDelegates::OnWorldPreActorTick.AddUObject(this, &UServerLoadTestSubsystem::OnPreActorTick);
+	PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &UServerLoadTestSubsystem::OnPostActorTick);
+}
+
+void UServerLoadTestSubsystem::Deinitialize()
+{
+	FWorldDelegates::OnWorldPreActorTick.Remove(PreActorTickHandle);
+	FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+
+	Bots.Reset();
+
+	Super::Deinitialize();
+}
+
+void UServerLoadTestSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	int32 NumBots = 0;
+	if (FParse::Value(FCommandLine::Get(), TEXT("TP2Bots="), NumBots) && NumBots > 0)
+	{
+		float Seconds = 60.0f;
+		FParse::Value(FCommandLine::Get(), TEXT("TP2LoadTestSeconds="), Seconds);
+
+		StartLoadTest(NumBots, Seconds);
+		bExitWhenDone = IsRunning();
+	}
+}
+
+void UServerLoadTestSubsystem::StartLoadTest(int32 NumBots, float MeasureSeconds)
+{
+	// 봇은 서버 권한으로만 스폰
+	if (IsRunning() || NumBots <= 0 || GetWorld()->GetNetMode() == NM_Client)
+	{
+		return;
+	}
+
+	RequestedBots = NumBots;
+	MeasureDuration = FMath::Max(MeasureSeconds, 1.0f);
+	BaselineFrames.Reset();
+	MeasureFrames.Reset();
+
+	Phase = EPhase::Baseline;
+	PhaseEndTime = FPlatformTime::Seconds() + ServerLoadTest::BaselineSeconds;
+
+	UE_LOG(LogTestProject2, Display, TEXT("Server load test: measuring baseline for %.0f s, then %d bots for %.0f s"), ServerLoadTest::BaselineSeconds, RequestedBots, MeasureDuration);
+}
+
+bool UServerLoadTestSubsystem::IsTickable() const
+{
+	return IsRunning();
+}
+
+void UServerLoadTestSubsystem::OnPreActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds)
+{
+	if (InWorld == GetWorld() && IsRunning())
+	{
+		ActorTickStartCycles = FPlatformTime::Cycles64();
+	}
+}
+
+void UServerLoadTestSubsystem::OnPostActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds)
+{
+	if (InWorld == GetWorld() && IsRunning() && ActorTickStartCycles != 0)
+	{
+		LastActorTickMs = float(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - ActorTickStartCycles));
+		ActorTickStartCycles = 0;
+	}
+}
+
+void UServerLoadTestSubsystem::RecordFrame()
+{
+	FFrameSamples* Samples = Phase == EPhase::Baseline ? &BaselineFrames : Phase == EPhase::Measure ? &MeasureFrames : nullptr;
+	if (Samples)
+	{
+		// 서버 틱 레이트 제한으로 잠든 시간을 빼면 게임 스레드가 실제로 일한 시간
+		Samples->BusyMs.Add(float((FApp::GetDeltaTime() - FApp::GetIdleTime()) * 1000.0));
+		Samples->ActorTickMs.Add(LastActorTickMs);
+	}
+}
+
+void UServerLoadTestSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	RecordFrame();
+	UpdateBots();
+
+	if (FPlatformTime::Seconds() < PhaseEndTime)
+	{
+		return;
+	}
+
+	switch (Phase)
+	{
+	case EPhase::Baseline:
+		UsedPhysicalBeforeBots = FPlatformMemory::GetStats().UsedPhysical;
+		ObjectsBeforeBots = GUObjectArray.GetObjectArrayNumMinusAvailable();
+		SpawnBots();
+		Phase = EPhase::Settle;
+		PhaseEndTime = FPlatformTime::Seconds() + ServerLoadTest::SettleSeconds;
+		break;
+
+	case EPhase::Settle:
+		UsedPhysicalWithBots = FPlatformMemory::GetStats().UsedPhysical;
+		ObjectsWithBots = GUObjectArray.GetObjectArrayNumMinusAvailable();
+		Phase = EPhase::Measure;
+		PhaseEndTime = FPlatformTime::Seconds() + MeasureDuration;
+		break;
+
+	case EPhase::Measure:
+		FinishLoadTest();
+		break;
+
+	default:
+		break;
+	}
+}
+
+void UServerLoadTestSubsystem::SpawnBots()
+{
+	UWorld* World = GetWorld();
+	AGameModeBase* GameMode = World->GetAuthGameMode();
+	UClass* PawnClass = GameMode ? GameMode->GetDefaultPawnClassForController(nullptr) : nullptr;
+	if (PawnClass == nullptr || !PawnClass->IsChildOf<ATestProject2Character>())
+	{
+		UE_LOG(LogTestProject2, Error, TEXT("Server load test: default pawn class %s is not a TestProject2Character"), *GetNameSafe(PawnClass));
+		return;
+	}
+
+	const AActor* PlayerStart = GameMode->FindPlayerStart(nullptr);
+	const FVector Origin = PlayerStart ? PlayerStart->GetActorLocation() : FVector::ZeroVector;
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	Bots.Reserve(RequestedBots);
+	for (int32 Index = 0; Index < RequestedBots; ++Index)
+	{
+		const FVector2D Offset = FMath::RandPointInCircle(ServerLoadTest::SpawnRadius);
+		const FVector Location = Origin + FVector(Offset.X, Offset.Y, 0.0f);
+		ATestProject2Character* Character = World->SpawnActor<ATestProject2Character>(PawnClass, Location, FRotator(0.0f, FMath::FRandRange(0.0f, 360.0f), 0.0f), SpawnParams);
+		if (Character)
+		{
+			// AI 컨트롤러가 있어야 서버에서 이동 컴포넌트가 입력을 처리함
+			Character->SpawnDefaultController();
+			Bots.AddDefaulted_GetRef().Character = Character;
+		}
+	}
+}
+
+void UServerLoadTestSubsystem::UpdateBots()
+{
+	const double Now = FPlatformTime::Seconds();
+
+	for (FBot& Bot : Bots)
+	{
+		ATestProject2Character* Character = Bot.Character.Get();
+		if (Character == nullptr)
+		{
+			continue;
+		}
+
+		if (Now >= Bot.NextDecisionTime)
+		{
+			Bot.NextDecisionTime = Now + FMath::FRandRange(ServerLoadTest::MinDecisionSeconds, ServerLoadTest::MaxDecisionSeconds);
+			Bot.MoveDirection = FRotator(0.0f, FMath::FRandRange(0.0f, 360.0f), 0.0f).Vector();
+
+			if (FMath::FRand() < ServerLoadTest::JumpChance)
+			{
+				Character->Jump();
+			}
+			if (FMath::FRand() < ServerLoadTest::ClimbChance)
+			{
+				Character->TryClimb();
+			}
+		}
+
+		Character->AddMovementInput(Bot.MoveDirection);
+	}
+}
+
+void UServerLoadTestSubsystem::FinishLoadTest()
+{
+	Phase = EPhase::Idle;
+
+	const int32 NumBots = Bots.Num();
+	const UNetDriver* NetDriver = GetWorld()->GetNetDriver();
+	const float TickRate = NetDriver ? NetDriver->GetNetServerMaxTickRate() : 30.0f;
+	const float TickBudgetMs = TickRate > 0.0f ? 1000.0f / TickRate : 33.3f;
+	const int32 NumConnections = NetDriver ? NetDriver->ClientConnections.Num() : 0;
+
+	const float BaselineBusyMs = FFrameSamples::Average(BaselineFrames.BusyMs);
+	const float MeasureBusyMs = FFrameSamples::Average(MeasureFrames.BusyMs);
+	const float MeasureBusyP95Ms = FFrameSamples::Percentile(MeasureFrames.BusyMs, 0.95f);
+	const float BaselineActorTickMs = FFrameSamples::Average(BaselineFrames.ActorTickMs);
+	const float MeasureActorTickMs = FFrameSamples::Average(MeasureFrames.ActorTickMs);
+
+	const float BusyMsPerBot = NumBots > 0 ? FMath::Max(MeasureBusyMs - BaselineBusyMs, 0.0f) / NumBots : 0.0f;
+	const float BusyP95MsPerBot = NumBots > 0 ? FMath::Max(MeasureBusyP95Ms - BaselineBusyMs, 0.0f) / NumBots : 0.0f;
+	const double KBPerBot = NumBots > 0 ? (double(UsedPhysicalWithBots) - double(UsedPhysicalBeforeBots)) / 1024.0 / NumBots : 0.0;
+	const float ObjectsPerBot = NumBots > 0 ? float(ObjectsWithBots - ObjectsBeforeBots) / NumBots : 0.0f;
+
+	// p95 프레임이 틱 예산 안에 들어오는 플레이어 수 (봇 비용이 선형으로 늘어난다고 가정)
+	const int32 EstimatedMaxPlayers = BusyP95MsPerBot > 0.0f ? FMath::FloorToInt32((TickBudgetMs - BaselineBusyMs) / BusyP95MsPerBot) : 0;
+
+	FString Csv = TEXT("Bots,Connections,TickRate,BaselineBusyMs,BusyMs,BusyP95Ms,BaselineActorTickMs,ActorTickMs,BusyMsPerBot,KBPerBot,ObjectsPerBot,EstimatedMaxPlayers") LINE_TERMINATOR;
+	Csv += FString::Printf(TEXT("%d,%d,%.1f,%.3f,%.3f,%.3f,%.3f,%.3f,%.4f,%.1f,%.1f,%d") LINE_TERMINATOR,
+		NumBots, NumConnections, TickRate, BaselineBusyMs, MeasureBusyMs, MeasureBusyP95Ms, BaselineActorTickMs, MeasureActorTickMs,
+		BusyMsPerBot, KBPerBot, ObjectsPerBot, EstimatedMaxPlayers);
+
+	const FString CsvPath = FPaths::ProjectSavedDir() / TEXT("Profiling/ServerLoad")
+		/ FString::Printf(TEXT("ServerLoad_%dBots_%s.csv"), NumBots, *FDateTime::Now().ToString());
+	FFileHelper::SaveStringToFile(Csv, *CsvPath);
+
+	UE_LOG(LogTestProject2, Display, TEXT("Server load test: %d bots, %.3f ms busy (p95 %.3f, baseline %.3f) of %.1f ms budget, %.4f ms and %.1f KB per bot, estimated %d players -> %s"),
+		NumBots, MeasureBusyMs, MeasureBusyP95Ms, BaselineBusyMs, TickBudgetMs, BusyMsPerBot, KBPerBot, EstimatedMaxPlayers, *CsvPath);
+
+	DestroyBots();
+
+	if (bExitWhenDone)
+	{
+		FPlatformMisc::RequestExit(false, TEXT("ServerLoadTest"));
+	}
+}
+
+void UServerLoadTestSubsystem::DestroyBots()
+{
+	for (const FBot& Bot : Bots)
+	{
+		if (ATestProject2Character* Character = Bot.Character.Get())
+		{
+			if (AController* Controller = Character->GetController())
+			{
+				Controller->Destroy();
+			}
+			Character->Destroy();
+		}
+	}
+	Bots.Reset();
+}
+
+TStatId UServerLoadTestSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UServerLoadTestSubsystem, STATGROUP_Tickables);
+}
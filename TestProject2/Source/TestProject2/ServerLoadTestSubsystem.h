@@ -0,0 +1,104 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ServerLoadTestSubsystem.generated.h"
+
+class ATestProject2Character;
+
+/**
+ * 서버 부하 측정: 봇 캐릭터를 스폰해 돌아다니게 (이동 / 점프 / 올라가기) 하고
+ * 봇당 메모리와 서버 프레임 비용을 측정하여 서버 프로세스 하나가 감당할 수 있는 플레이어 수를 추정합니다.
+ *
+ * 로컬 데디케이티드 서버 실행 예:
+ *   TestProject2Server -log -TP2Bots=64 -TP2LoadTestSeconds=60
+ * 측정이 끝나면 Saved/Profiling/ServerLoad 에 CSV 를 쓰고 종료합니다.
+ * 콘솔 명령 TestProject2.Server.LoadTest <Bots> [Seconds] 로 실행 중인 서버 / 리슨 서버에서도 시작할 수 있습니다.
+ */
+UCLASS()
+class TESTPROJECT2_API UServerLoadTestSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** 기준 프레임을 측정한 뒤 봇 NumBots 명을 스폰하고 MeasureSeconds 동안 측정 */
+	void StartLoadTest(int32 NumBots, float MeasureSeconds);
+
+	bool IsRunning() const { return Phase != EPhase::Idle; }
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+private:
+	enum class EPhase : uint8
+	{
+		Idle,
+		Baseline,
+		Settle,
+		Measure,
+	};
+
+	struct FBot
+	{
+		TWeakObjectPtr<ATestProject2Character> Character;
+		FVector MoveDirection = FVector::ForwardVector;
+		double NextDecisionTime = 0.0;
+	};
+
+	/** 프레임 통계 (게임 스레드 사용 시간, 액터 틱 시간) */
+	struct FFrameSamples
+	{
+		TArray<float> BusyMs;
+		TArray<float> ActorTickMs;
+
+		void Reset() { BusyMs.Reset(); ActorTickMs.Reset(); }
+		static float Average(const TArray<float>& Samples);
+		static float Percentile(TArray<float> Samples, float Percent);
+	};
+
+	void SpawnBots();
+	void UpdateBots();
+	void FinishLoadTest();
+	void DestroyBots();
+
+	void OnPreActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds);
+	void OnPostActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds);
+
+	/** 현재 단계의 프레임 샘플 추가 */
+	void RecordFrame();
+
+	EPhase Phase = EPhase::Idle;
+	double PhaseEndTime = 0.0;
+
+	int32 RequestedBots = 0;
+	float MeasureDuration = 60.0f;
+
+	/** 명령줄로 시작한 경우 측정 후 종료 */
+	bool bExitWhenDone = false;
+
+	TArray<FBot> Bots;
+
+	FFrameSamples BaselineFrames;
+	FFrameSamples MeasureFrames;
+
+	uint64 UsedPhysicalBeforeBots = 0;
+	int32 ObjectsBeforeBots = 0;
+	uint64 UsedPhysicalWithBots = 0;
+	int32 ObjectsWithBots = 0;
+
+	uint64 ActorTickStartCycles = 0;
+	float LastActorTickMs = 0.0f;
+
+	FDelegateHandle PreActorTickHandle;
+	FDelegateHandle PostActorTickHandle;
+};
@@ -0,0 +1,267 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ShaderWarmupSubsystem.h"
+#include "ScreenEffectSubsystem.h"
+#include "TestProject2.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Materials/MaterialInterface.h"
+#include "PSOPrecache.h"
+#include "VertexFactory.h"
+#include "PipelineStateCache.h"
+#include "PipelineFileCache.h"
+#include "ShaderPipelineCache.h"
+#include "DynamicRHI.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CommandLine.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace ShaderWarmup
+{
+	/** 워밍업 중 화면 효과 레이어 가중치 (눈에 띄지 않지만 레이어가 켜져 그려짐) */
+	constexpr float LayerWarmupWeight = 0.01f;
+
+	const FName PostProcessLayerPrefix = TEXT("ShaderWarmup");
+}
+
+bool UShaderWarmupSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	return Super::ShouldCreateSubsystem(Outer) && !IsRunningDedicatedServer();
+}
+
+bool UShaderWarmupSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UShaderWarmupSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	bValidateCache = FParse::Param(FCommandLine::Get(), TEXT("TP2ValidatePSOCache"));
+	if (bValidateCache)
+	{
+		// 프리캐시에서 빠진 PSO 를 로그 / 스탯으로 보고하고, 번들 캐시에 없던 PSO 를 기록
+		if (IConsoleVariable* Validation = IConsoleManager::Get().FindConsoleVariable(TEXT("r.PSOPrecache.Validation")))
+		{
+			Validation->Set(2, ECVF_SetByCode);
+		}
+		if (IConsoleVariable* LogPSO = IConsoleManager::Get().FindConsoleVariable(TEXT("r.ShaderPipelineCache.LogPSO")))
+		{
+			LogPSO->Set(1, ECVF_SetByCode);
+		}
+	}
+
+	if (!bEnabled)
+	{
+		State = EState::Finished;
+	}
+}
+
+void UShaderWarmupSubsystem::OnWorldComponentsUpdated(UWorld& InWorld)
+{
+	Super::OnWorldComponentsUpdated(InWorld);
+
+	// 레벨 컴포넌트는 등록 시 스스로 PSO 프리캐시를 요청하므로, 등록 직후 (플레이어 로그인 전) 에 시작
+	if (State == EState::Pending)
+	{
+		StartWarmup();
+	}
+}
+
+void UShaderWarmupSubsystem::StartWarmup()
+{
+	State = EState::Warming;
+	StartTime = FPlatformTime::Seconds();
+
+	// 번들 PSO 캐시는 게임플레이 중에는 백그라운드 속도로 컴파일되므로 워밍업 동안만 빠르게
+	BundledPrecompilesAtStart = FShaderPipelineCache::NumPrecompilesRemaining();
+	FShaderPipelineCache::SetBatchMode(FShaderPipelineCache::BatchMode::Fast);
+
+	MaterialRequests = PrecacheMaterials();
+
+	// 후처리 머티리얼은 메시 PSO 가 아니므로 화면 효과 레이어로 한 번 그림
+	if (UScreenEffectSubsystem* ScreenEffects = GetWorld()->GetSubsystem<UScreenEffectSubsystem>())
+	{
+		for (int32 Index = 0; Index < PostProcessMaterials.Num(); ++Index)
+		{
+			if (UMaterialInterface* Material = PostProcessMaterials[Index].LoadSynchronous())
+			{
+				ScreenEffects->RegisterMaterialLayer(FName(ShaderWarmup::PostProcessLayerPrefix, Index + 1), Material);
+			}
+		}
+	}
+}
+
+int32 UShaderWarmupSubsystem::PrecacheMaterials()
+{
+	if (!IsResourcePSOPrecachingEnabled() && !IsComponentPSOPrecachingEnabled())
+	{
+		return 0;
+	}
+
+	FPSOPrecacheVertexFactoryDataList VertexFactories;
+	for (const FName& TypeName : VertexFactoryTypes)
+	{
+		if (const FVertexFactoryType* Type = FVertexFactoryType::GetVFByName(FHashedName(TypeName.ToString())))
+		{
+			VertexFactories.Add(FPSOPrecacheVertexFactoryData(Type));
+		}
+	}
+
+	FPSOPrecacheParams Params;
+	TArray<FMaterialPSOPrecacheRequestID> RequestIDs;
+	for (const TSoftObjectPtr<UMaterialInterface>& MaterialRef : Materials)
+	{
+		if (UMaterialInterface* Material = MaterialRef.LoadSynchronous())
+		{
+			Material->PrecachePSOs(VertexFactories, Params, EPSOPrecachePriority::High, RequestIDs);
+		}
+	}
+	return RequestIDs.Num();
+}
+
+bool UShaderWarmupSubsystem::IsTickable() const
+{
+	return State == EState::Warming;
+}
+
+void UShaderWarmupSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	++Frames;
+	ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+
+	// 로그인 / 캐릭터 BeginPlay 에서 생긴 플레이어와 레이어도 매 프레임 반영
+	SetLocalPlayersFaded(true);
+	SetScreenLayersWarmup(true);
+
+	const uint32 ActiveRequests = PipelineStateCache::NumActivePrecacheRequests();
+	PeakActivePrecacheRequests = FMath::Max(PeakActivePrecacheRequests, ActiveRequests);
+	BundledPrecompilesRemaining = FShaderPipelineCache::NumPrecompilesRemaining();
+
+	const bool bDone = Frames >= MinWarmupFrames && ActiveRequests == 0 && BundledPrecompilesRemaining == 0;
+	const bool bTimedOut = !bDone && ElapsedSeconds >= MaxWarmupSeconds;
+	if (bDone || bTimedOut)
+	{
+		FinishWarmup(bTimedOut);
+	}
+}
+
+void UShaderWarmupSubsystem::FinishWarmup(bool bTimedOut)
+{
+	State = EState::Finished;
+
+	FShaderPipelineCache::SetBatchMode(FShaderPipelineCache::BatchMode::Background);
+	SetScreenLayersWarmup(false);
+	SetLocalPlayersFaded(false);
+
+	WriteReport(bTimedOut);
+	OnWarmupFinished.Broadcast();
+}
+
+void UShaderWarmupSubsystem::SetScreenLayersWarmup(bool bWarmup)
+{
+	UScreenEffectSubsystem* ScreenEffects = GetWorld()->GetSubsystem<UScreenEffectSubsystem>();
+	if (ScreenEffects == nullptr)
+	{
+		return;
+	}
+
+	if (!bWarmup)
+	{
+		for (const FName& Layer : WarmedLayers)
+		{
+			ScreenEffects->SetLayerWeight(Layer, 0.0f);
+		}
+		WarmedLayers.Reset();
+		return;
+	}
+
+	// 꺼져 있는 레이어만 켬 (이미 쓰이는 레이어의 가중치는 건드리지 않음)
+	TArray<FName> LayerNames;
+	ScreenEffects->GetLayerNames(LayerNames);
+	for (const FName& Layer : LayerNames)
+	{
+		if (!WarmedLayers.Contains(Layer) && ScreenEffects->GetLayerWeight(Layer) == 0.0f)
+		{
+			ScreenEffects->SetLayerWeight(Layer, ShaderWarmup::LayerWarmupWeight);
+			WarmedLayers.Add(Layer);
+		}
+	}
+}
+
+void UShaderWarmupSubsystem::SetLocalPlayersFaded(bool bFaded)
+{
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		APlayerController* PlayerController = It->Get();
+		if (PlayerController && PlayerController->IsLocalController() && PlayerController->PlayerCameraManager)
+		{
+			// 페이드는 장면 렌더링 뒤에 적용되므로 가려진 동안에도 PSO 가 만들어짐
+			if (bFaded)
+			{
+				PlayerController->PlayerCameraManager->SetManualCameraFade(1.0f, FLinearColor::Black, false);
+			}
+			else
+			{
+				PlayerController->PlayerCameraManager->StopCameraFade();
+			}
+		}
+	}
+}
+
+void UShaderWarmupSubsystem::WriteReport(bool bTimedOut) const
+{
+	const uint32 BundledCompiled = BundledPrecompilesAtStart - FMath::Min(BundledPrecompilesAtStart, BundledPrecompilesRemaining);
+	const FString MapName = GetWorld()->GetMapName();
+
+	UE_LOG(LogTestProject2, Display, TEXT("Shader warm-up for %s on %s %s in %.2f s (%d frames): %d material PSO requests, peak %u active precache requests, %u bundled PSOs compiled, %u left"),
+		*MapName, GDynamicRHI ? GDynamicRHI->GetName() : TEXT("NullRHI"), bTimedOut ? TEXT("timed out") : TEXT("finished"),
+		ElapsedSeconds, Frames, MaterialRequests, PeakActivePrecacheRequests, BundledCompiled, BundledPrecompilesRemaining);
+
+	FString Csv = TEXT("Map,RHI,TimedOut,Seconds,Frames,MaterialRequests,PeakActivePrecacheRequests,BundledCompiled,BundledRemaining") LINE_TERMINATOR;
+	Csv += FString::Printf(TEXT("%s,%s,%d,%.3f,%d,%d,%u,%u,%u") LINE_TERMINATOR,
+		*MapName, GDynamicRHI ? GDynamicRHI->GetName() : TEXT("NullRHI"), bTimedOut ? 1 : 0,
+		ElapsedSeconds, Frames, MaterialRequests, PeakActivePrecacheRequests, BundledCompiled, BundledPrecompilesRemaining);
+
+	const FString Path = FPaths::ProjectSavedDir() / TEXT("Profiling/ShaderWarmup") / FString::Printf(TEXT("ShaderWarmup_%s_%s.csv"), *MapName, *FDateTime::Now().ToString());
+	FFileHelper::SaveStringToFile(Csv, *Path);
+}
+
+void UShaderWarmupSubsystem::SaveValidationCache() const
+{
+	// LogPSO 는 번들 캐시에 없던 PSO 만 기록하므로, 0 이면 번들 캐시가 이 맵을 모두 덮음
+	const uint32 MissingPSOs = FPipelineFileCacheManager::NumPSOsLogged();
+	const bool bSaved = MissingPSOs > 0 && FShaderPipelineCache::SavePipelineFileCache(FPipelineFileCacheManager::SaveMode::BoundPSOsOnly);
+
+	UE_LOG(LogTestProject2, Display, TEXT("PSO cache validation for %s: %u bound PSOs were missing from the bundled cache%s"),
+		*GetWorld()->GetMapName(), MissingPSOs, bSaved ? TEXT(" (saved as a pipeline cache under Saved/CollectedPSOs)") : TEXT(""));
+}
+
+void UShaderWarmupSubsystem::Deinitialize()
+{
+	if (State == EState::Warming)
+	{
+		FShaderPipelineCache::SetBatchMode(FShaderPipelineCache::BatchMode::Background);
+	}
+
+	if (bValidateCache)
+	{
+		SaveValidationCache();
+	}
+
+	OnWarmupFinished.Clear();
+
+	Super::Deinitialize();
+}
+
+TStatId UShaderWarmupSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UShaderWarmupSubsystem, STATGROUP_Tickables);
+}
@@ -0,0 +1,110 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ShaderWarmupSubsystem.generated.h"
+
+class APlayerController;
+class UMaterialInterface;
+
+/** 워밍업이 끝나면 (완료 / 시간 초과 모두) 한 번 호출됩니다. */
+DECLARE_MULTICAST_DELEGATE(FOnShaderWarmupFinished);
+
+/**
+ * 맵 시작 시 게임플레이 전에 PSO 프리캐시 / 셰이더 워밍업을 진행합니다.
+ * 월드 컴포넌트가 등록된 직후 설정된 머티리얼의 PSO 프리캐시와 번들 PSO 캐시 일괄 컴파일을 시작하고,
+ * 요청이 모두 끝날 때까지 화면을 검게 가린 채 등록된 화면 효과 레이어를 아주 작은 가중치로 그립니다.
+ * 그동안 게임 모드는 플레이어 폰 스폰을 미룹니다. 끝나면 컴파일 수 / 소요 시간을 로그와 CSV 로 남깁니다.
+ *
+ * -TP2ValidatePSOCache 로 실행하면 r.PSOPrecache.Validation 을 켜고, 월드 종료 시 번들 캐시에 없었는데
+ * 실제로 바인딩된 PSO 를 Saved 아래 파이프라인 캐시 파일로 저장하여 번들 캐시를 검증할 수 있습니다.
+ * 데디케이티드 서버에서는 생성되지 않습니다.
+ */
+UCLASS(config = Game)
+class TESTPROJECT2_API UShaderWarmupSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** 워밍업이 진행 중인지 (시작 전 대기 포함) */
+	bool IsWarmingUp() const { return State != EState::Finished; }
+
+	FOnShaderWarmupFinished OnWarmupFinished;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void OnWorldComponentsUpdated(UWorld& InWorld) override;
+
+protected:
+	/** 워밍업 사용 여부 */
+	UPROPERTY(config)
+	bool bEnabled = true;
+
+	/** PSO 를 미리 만들 머티리얼 (레벨 프로토타입 그리드, 캐릭터 등 맵 로드 시 바로 보이지 않는 것 포함) */
+	UPROPERTY(config)
+	TArray<TSoftObjectPtr<UMaterialInterface>> Materials;
+
+	/** Materials 와 조합할 버텍스 팩토리 타입 이름 (예: FLocalVertexFactory) */
+	UPROPERTY(config)
+	TArray<FName> VertexFactoryTypes;
+
+	/** 워밍업 중 한 번 그려 볼 후처리 머티리얼 (화면 효과 레이어로 등록) */
+	UPROPERTY(config)
+	TArray<TSoftObjectPtr<UMaterialInterface>> PostProcessMaterials;
+
+	/** 요청이 모두 끝났더라도 최소한 그릴 프레임 수 (화면 효과 레이어 워밍업) */
+	UPROPERTY(config)
+	int32 MinWarmupFrames = 3;
+
+	/** 이 시간이 지나면 남은 요청이 있어도 게임을 시작 (실제 시간, 초) */
+	UPROPERTY(config)
+	float MaxWarmupSeconds = 20.0f;
+
+private:
+	enum class EState : uint8
+	{
+		Pending,
+		Warming,
+		Finished,
+	};
+
+	void StartWarmup();
+	void FinishWarmup(bool bTimedOut);
+
+	/** 설정된 머티리얼의 PSO 프리캐시 요청을 발행하고 요청 수를 반환 */
+	int32 PrecacheMaterials();
+
+	/** 워밍업 중 화면 효과 레이어 가중치 (0 이면 원래대로) */
+	void SetScreenLayersWarmup(bool bWarmup);
+
+	/** 로컬 플레이어 화면을 검게 가림 (로딩 화면 대신) */
+	void SetLocalPlayersFaded(bool bFaded);
+
+	void WriteReport(bool bTimedOut) const;
+
+	/** 검증 모드: 바인딩된 PSO 중 번들 캐시에 없던 것을 저장 */
+	void SaveValidationCache() const;
+
+	EState State = EState::Pending;
+	bool bValidateCache = false;
+
+	/** 워밍업 중 가중치를 올린 화면 효과 레이어 */
+	TArray<FName> WarmedLayers;
+
+	double StartTime = 0.0;
+	double ElapsedSeconds = 0.0;
+	int32 Frames = 0;
+	int32 MaterialRequests = 0;
+	uint32 PeakActivePrecacheRequests = 0;
+	uint32 BundledPrecompilesAtStart = 0;
+	uint32 BundledPrecompilesRemaining = 0;
+};
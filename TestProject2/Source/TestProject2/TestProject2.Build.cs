@@ -9,5 +9,10 @@ public class TestProject2 : ModuleRules
 		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
 
 		PublicDependencyModuleNames.AddRange(new string[] { "Core", "CoreUObject", "Engine", "InputCore", "HeadMountedDisplay", "EnhancedInput" });
+
+		PrivateDependencyModuleNames.AddRange(new string[] { "Json", "SignificanceManager", "AnimationBudgetAllocator", "AudioModulation", "AudioExtensions", "NavigationSystem", "RenderCore", "RHI", "Niagara" });
+
+		// GameplayDebugger 의존성과 WITH_GAMEPLAY_DEBUGGER 정의 (Shipping 등 게임플레이 디버거가 없는 타깃에서는 0)
+		SetupGameplayDebuggerSupport(Target);
 	}
 }
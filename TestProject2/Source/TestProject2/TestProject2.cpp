@@ -2,6 +2,114 @@
 
 #include "TestProject2.h"
 #include "Modules/ModuleManager.h"
+#include "Misc/CoreDelegates.h"
+#include "Engine/Engine.h"
+#include "TimeDilationSubsystem.h"
 
-IMPLEMENT_PRIMARY_GAME_MODULE( FDefaultGameModuleImpl, TestProject2, "TestProject2" );
- 
\ No newline at end of file
+#if WITH_GAMEPLAY_DEBUGGER
+#include "GameplayDebugger.h"
+#include "GameplayDebuggerCategory_TestProject2.h"
+#endif
+
+class FTestProject2Module : public FDefaultGameModuleImpl
+{
+public:
+	virtual void StartupModule() override
+	{
+#if CSV_PROFILER
+		EndFrameHandle = FCoreDelegates::OnEndFrame.AddStatic(&FTestProject2Module::RecordCsvFrameStats);
+#endif
+
+#if WITH_GAMEPLAY_DEBUGGER
+		IGameplayDebugger& GameplayDebugger = IGameplayDebugger::Get();
+		GameplayDebugger.RegisterCategory("TestProject2", IGameplayDebugger::FOnGetCategory::CreateStatic(&FGameplayDebuggerCategory_TestProject2::MakeInstance),
+			EGameplayDebuggerCategoryState::EnabledInGameAndSimulate, 5);
+		GameplayDebugger.NotifyCategoriesChanged();
+#endif
+	}
+
+	virtual void ShutdownModule() override
+	{
+#if CSV_PROFILER
+		FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+#endif
+
+#if WITH_GAMEPLAY_DEBUGGER
+		if (IGameplayDebugger::IsAvailable())
+		{
+			IGameplayDebugger& GameplayDebugger = IGameplayDebugger::Get();
+			GameplayDebugger.UnregisterCategory("TestProject2");
+			GameplayDebugger.NotifyCategoriesChanged();
+		}
+#endif
+	}
+
+private:
+#if CSV_PROFILER
+	/** 프레임마다 갱신되지 않는 상태를 CSV 열로 기록 (캡처 중일 때만) */
+	static void RecordCsvFrameStats()
+	{
+		if (!FCsvProfiler::Get()->IsCapturing() || GEngine == nullptr)
+		{
+			return;
+		}
+
+		float SlowMotionWeight = 0.0f;
+		for (const FWorldContext& Context : GEngine->GetWorldContexts())
+		{
+			if (const UTimeDilationSubsystem* TimeDilation = UWorld::GetSubsystem<UTimeDilationSubsystem>(Context.World()))
+			{
+				SlowMotionWeight = FMath::Max(SlowMotionWeight, TimeDilation->GetSlowMotionWeight());
+			}
+		}
+
+		CSV_CUSTOM_STAT(TestProject2, ActiveClimbers, TestProject2Csv::ActiveClimbers, ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(TestProject2, SlowMotionWeight, SlowMotionWeight, ECsvCustomStatOp::Set);
+	}
+
+	FDelegateHandle EndFrameHandle;
+#endif
+};
+
+IMPLEMENT_PRIMARY_GAME_MODULE( FTestProject2Module, TestProject2, "TestProject2" );
+
+DEFINE_LOG_CATEGORY(LogTestProject2);
+
+DEFINE_STAT(STAT_TP2_CharacterTick);
+DEFINE_STAT(STAT_TP2_TryClimb);
+DEFINE_STAT(STAT_TP2_PhysClimb);
+DEFINE_STAT(STAT_TP2_ClimbBatchUpdate);
+DEFINE_STAT(STAT_TP2_LedgeQueryIssue);
+DEFINE_STAT(STAT_TP2_LedgeQueryCollect);
+DEFINE_STAT(STAT_TP2_FindLedgeInFront);
+DEFINE_STAT(STAT_TP2_SlowMotionUpdate);
+DEFINE_STAT(STAT_TP2_SlowMotionListener);
+DEFINE_STAT(STAT_TP2_JumpPadOverlap);
+DEFINE_STAT(STAT_TP2_JumpPadDispatch);
+DEFINE_STAT(STAT_TP2_AnimStatePublish);
+DEFINE_STAT(STAT_TP2_AnimStateUpdate);
+DEFINE_STAT(STAT_TP2_TimeBubbleUpdate);
+DEFINE_STAT(STAT_TP2_EffectPoolPlay);
+
+DEFINE_STAT(STAT_TP2_ActiveClimbers);
+DEFINE_STAT(STAT_TP2_JumpPadLaunches);
+DEFINE_STAT(STAT_TP2_LedgeQueries);
+DEFINE_STAT(STAT_TP2_SlowMotionUpdates);
+
+DEFINE_STAT(STAT_TP2_TimeBubbleActors);
+
+DEFINE_STAT(STAT_TP2_EffectPoolHits);
+DEFINE_STAT(STAT_TP2_EffectPoolMisses);
+DEFINE_STAT(STAT_TP2_EffectPoolCulled);
+DEFINE_STAT(STAT_TP2_EffectPoolPeakInUse);
+
+DEFINE_STAT(STAT_TP2_InputLatencyMove);
+DEFINE_STAT(STAT_TP2_InputLatencyLook);
+DEFINE_STAT(STAT_TP2_InputLatencyClimb);
+DEFINE_STAT(STAT_TP2_InputLatencySlowMotion);
+
+UE_TRACE_CHANNEL_DEFINE(TestProject2Channel);
+
+CSV_DEFINE_CATEGORY_MODULE(TESTPROJECT2_API, TestProject2, true);
+
+int32 TestProject2Csv::ActiveClimbers = 0;
@@ -3,3 +3,77 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+/** 게임 모듈의 서브시스템과 데이터 에셋이 공통으로 사용하는 로그 카테고리 */
+TESTPROJECT2_API DECLARE_LOG_CATEGORY_EXTERN(LogTestProject2, Log, All);
+
+// =============== 게임플레이 프로파일링 (stat TestProject2 / Insights / CSV 프로파일러) ===============
+// 스탯은 STATS 가 꺼진 빌드 (Shipping) 에서, 트레이스 스코프는 Shipping 에서 모두 컴파일되지 않습니다.
+
+DECLARE_STATS_GROUP(TEXT("TestProject2"), STATGROUP_TestProject2, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Character Tick"), STAT_TP2_CharacterTick, STATGROUP_TestProject2, TESTPROJECT2_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("TryClimb"), STAT_TP2_TryClimb, STATGROUP_TestProject2, TESTPROJECT2_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("PhysClimb"), STAT_TP2_PhysClimb, STATGROUP_TestProject2, TESTPROJECT2_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Climb Batch Update"), STAT_TP2_ClimbBatchUpdate, STATGROUP_TestProject2, TESTPROJECT2_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Ledge Query Issue"), STAT_TP2_LedgeQueryIssue, STATGROUP_TestProject2, TESTPROJECT2_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Ledge Query Collect"), STAT_TP2_LedgeQueryCollect, STATGROUP_TestProject2, TESTPROJECT2_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Find Ledge In Front"), STAT_TP2_FindLedgeInFront, STATGROUP_TestProject2, TESTPROJECT2_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Slow Motion Update"), STAT_TP2_SlowMotionUpdate, STATGROUP_TestProject2, TESTPROJECT2_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Slow Motion Listener"), STAT_TP2_SlowMotionListener, STATGROUP_TestProject2, TESTPROJECT2_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Jump Pad Overlap"), STAT_TP2_JumpPadOverlap, STATGROUP_TestProject2, TESTPROJECT2_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Jump Pad Dispatch"), STAT_TP2_JumpPadDispatch, STATGROUP_TestProject2, TESTPROJECT2_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Anim State Publish"), STAT_TP2_AnimStatePublish, STATGROUP_TestProject2, TESTPROJECT2_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Anim State Update"), STAT_TP2_AnimStateUpdate, STATGROUP_TestProject2, TESTPROJECT2_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Time Bubble Update"), STAT_TP2_TimeBubbleUpdate, STATGROUP_TestProject2, TESTPROJECT2_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Effect Pool Play"), STAT_TP2_EffectPoolPlay, STATGROUP_TestProject2, TESTPROJECT2_API);
+
+/** 현재 올라가기 모드인 캐릭터 수 (프레임마다 초기화되지 않음) */
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Active Climbers"), STAT_TP2_ActiveClimbers, STATGROUP_TestProject2, TESTPROJECT2_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Jump Pad Launches"), STAT_TP2_JumpPadLaunches, STATGROUP_TestProject2, TESTPROJECT2_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Ledge Queries"), STAT_TP2_LedgeQueries, STATGROUP_TestProject2, TESTPROJECT2_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Slow Motion Updates"), STAT_TP2_SlowMotionUpdates, STATGROUP_TestProject2, TESTPROJECT2_API);
+
+/** 시간 버블 안에 있는 액터 수 (멤버십이 바뀔 때만 갱신) */
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Time Bubble Actors"), STAT_TP2_TimeBubbleActors, STATGROUP_TestProject2, TESTPROJECT2_API);
+
+/** 이펙트 풀 재생: 쉬는 컴포넌트를 쓴 경우 / 모두 재생 중이라 가장 오래된 것을 끊은 경우 / 거리로 생략한 경우 */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Effect Pool Hits"), STAT_TP2_EffectPoolHits, STATGROUP_TestProject2, TESTPROJECT2_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Effect Pool Misses"), STAT_TP2_EffectPoolMisses, STATGROUP_TestProject2, TESTPROJECT2_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Effect Pool Culled"), STAT_TP2_EffectPoolCulled, STATGROUP_TestProject2, TESTPROJECT2_API);
+
+/** 종류별 최대 동시 사용 컴포넌트 수의 합 (풀 크기를 정할 때 참고) */
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Effect Pool Peak In Use"), STAT_TP2_EffectPoolPeakInUse, STATGROUP_TestProject2, TESTPROJECT2_API);
+
+/** 마지막으로 측정한 입력 -> 결과 지연 (ms, UInputLatencySubsystem) */
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Input Latency Move (ms)"), STAT_TP2_InputLatencyMove, STATGROUP_TestProject2, TESTPROJECT2_API);
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Input Latency Look (ms)"), STAT_TP2_InputLatencyLook, STATGROUP_TestProject2, TESTPROJECT2_API);
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Input Latency Climb (ms)"), STAT_TP2_InputLatencyClimb, STATGROUP_TestProject2, TESTPROJECT2_API);
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Input Latency Slow Motion (ms)"), STAT_TP2_InputLatencySlowMotion, STATGROUP_TestProject2, TESTPROJECT2_API);
+
+/** Insights 에서 게임플레이 코드만 켜고 끌 수 있는 트레이스 채널 (-trace=cpu,TestProject2) */
+UE_TRACE_CHANNEL_EXTERN(TestProject2Channel, TESTPROJECT2_API);
+
+/** CSV 프로파일러 (-csvCaptureFrames=N, csvprofile start) 의 게임플레이 카테고리. 열 이름은 TestProject2/<스탯> */
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(TESTPROJECT2_API, TestProject2);
+
+/** 값이 바뀔 때만 갱신되는 게임플레이 상태. 모듈이 프레임 끝마다 CSV 에 다시 기록 (틱 간격이 줄어든 캐릭터도 빠지지 않도록) */
+namespace TestProject2Csv
+{
+	/** 현재 올라가기 모드인 캐릭터 수 (STAT_TP2_ActiveClimbers 와 같은 곳에서 갱신) */
+	extern TESTPROJECT2_API int32 ActiveClimbers;
+}
+
+/** 스탯 사이클 카운터 + CSV 타이밍 스탯 + TestProject2 채널 CPU 이벤트를 함께 여는 스코프 */
+#if !UE_BUILD_SHIPPING
+	#define TP2_SCOPE_CYCLE_COUNTER(Stat) \
+		SCOPE_CYCLE_COUNTER(Stat); \
+		CSV_SCOPED_TIMING_STAT(TestProject2, Stat); \
+		TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR(#Stat, TestProject2Channel)
+#else
+	#define TP2_SCOPE_CYCLE_COUNTER(Stat)
+#endif
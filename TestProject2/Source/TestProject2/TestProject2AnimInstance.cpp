@@ -0,0 +1,34 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TestProject2AnimInstance.h"
+#include "TestProject2Character.h"
+#include "TestProject2.h"
+
+UTestProject2AnimInstance::UTestProject2AnimInstance()
+{
+	MoveSpeedThreshold = 3.0f;
+	bShouldMove = false;
+	Character = nullptr;
+}
+
+void UTestProject2AnimInstance::NativeInitializeAnimation()
+{
+	Super::NativeInitializeAnimation();
+
+	Character = Cast<ATestProject2Character>(TryGetPawnOwner());
+}
+
+void UTestProject2AnimInstance::NativeThreadSafeUpdateAnimation(float DeltaSeconds)
+{
+	Super::NativeThreadSafeUpdateAnimation(DeltaSeconds);
+
+	TP2_SCOPE_CYCLE_COUNTER(STAT_TP2_AnimStateUpdate);
+
+	if (Character == nullptr)
+	{
+		return;
+	}
+
+	State = Character->GetAnimStateSnapshot();
+	bShouldMove = !State.bIsFalling && !State.bIsClimbing && State.GroundSpeed > MoveSpeedThreshold;
+}
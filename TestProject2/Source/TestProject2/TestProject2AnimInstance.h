@@ -0,0 +1,91 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Animation/AnimInstance.h"
+#include "TestProject2AnimInstance.generated.h"
+
+class ATestProject2Character;
+
+/**
+ * 애니메이션 그래프가 읽는 캐릭터 상태 스냅샷.
+ * 게임 스레드에서 이동이 끝난 뒤 한 번 기록되고, 워커 스레드 애니메이션 업데이트에서는 복사본만 읽습니다.
+ */
+USTRUCT(BlueprintType)
+struct FCharacterAnimState
+{
+	GENERATED_BODY()
+
+	/** 올라가기 모드인지 */
+	UPROPERTY(BlueprintReadOnly, Category = "Climbing")
+	bool bIsClimbing = false;
+
+	/** 올라가기 진행률 (0.0 ~ 1.0) */
+	UPROPERTY(BlueprintReadOnly, Category = "Climbing")
+	float ClimbProgress = 0.0f;
+
+	/** 올라가기 목표 위치 (월드 좌표) */
+	UPROPERTY(BlueprintReadOnly, Category = "Climbing")
+	FVector ClimbTargetLocation = FVector::ZeroVector;
+
+	/** 이 캐릭터가 슬로우 모션을 요청 중인지 */
+	UPROPERTY(BlueprintReadOnly, Category = "SlowMotion")
+	bool bIsSlowMotionActive = false;
+
+	/** 월드 슬로우 모션 가중치 (0.0 = 정상 속도, 1.0 = 완전 슬로우 모션) */
+	UPROPERTY(BlueprintReadOnly, Category = "SlowMotion")
+	float SlowMotionWeight = 0.0f;
+
+	/** 점프대 등으로 발사된 뒤 아직 착지하지 않았는지 */
+	UPROPERTY(BlueprintReadOnly, Category = "Movement")
+	bool bIsLaunched = false;
+
+	/** 공중에 있는지 */
+	UPROPERTY(BlueprintReadOnly, Category = "Movement")
+	bool bIsFalling = false;
+
+	/** 이동 속도 (월드 좌표) */
+	UPROPERTY(BlueprintReadOnly, Category = "Movement")
+	FVector Velocity = FVector::ZeroVector;
+
+	/** 수평 이동 속력 */
+	UPROPERTY(BlueprintReadOnly, Category = "Movement")
+	float GroundSpeed = 0.0f;
+};
+
+/**
+ * ATestProject2Character 용 애니메이션 인스턴스.
+ * 게임 스레드 업데이트(NativeUpdateAnimation)는 사용하지 않고, NativeThreadSafeUpdateAnimation 에서
+ * 캐릭터가 공개한 스냅샷만 복사하므로 애니메이션 그래프 업데이트 전체가 워커 스레드에서 실행됩니다.
+ * 애니메이션 블루프린트의 그래프 / 함수는 BlueprintThreadSafe 로 State 만 읽어야 합니다.
+ */
+UCLASS(Transient, Blueprintable)
+class TESTPROJECT2_API UTestProject2AnimInstance : public UAnimInstance
+{
+	GENERATED_BODY()
+
+public:
+	UTestProject2AnimInstance();
+
+	/** 이번 업데이트에서 사용하는 캐릭터 상태 */
+	UPROPERTY(Transient, BlueprintReadOnly, Category = "Character")
+	FCharacterAnimState State;
+
+	/** 이동 중으로 볼 최소 수평 속력 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character")
+	float MoveSpeedThreshold;
+
+	/** 지면에서 이동 중인지 (State 에서 파생) */
+	UPROPERTY(Transient, BlueprintReadOnly, Category = "Character")
+	bool bShouldMove;
+
+protected:
+	virtual void NativeInitializeAnimation() override;
+	virtual void NativeThreadSafeUpdateAnimation(float DeltaSeconds) override;
+
+private:
+	/** 소유 캐릭터 (초기화 시 게임 스레드에서 설정, 워커 스레드에서는 스냅샷 복사에만 사용) */
+	UPROPERTY(Transient)
+	ATestProject2Character* Character;
+};
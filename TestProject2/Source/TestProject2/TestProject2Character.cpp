@@ -1,6 +1,7 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "TestProject2Character.h"
+#include "TestProject2.h"
 #include "Engine/LocalPlayer.h"
 #include "Camera/CameraComponent.h"
 #include "Components/CapsuleComponent.h"
@@ -10,28 +11,49 @@
 #include "EnhancedInputComponent.h"
 #include "EnhancedInputSubsystems.h"
 #include "InputActionValue.h"
-#include "DrawDebugHelpers.h" // 디버깅용 추가분
 #include "Kismet/KismetMathLibrary.h" // UKismetMathLibrary 포함
 #include "Animation/AnimMontage.h"
 #include "Animation/AnimInstance.h"
 #include "Kismet/GameplayStatics.h" // UGameplayStatics::SetGlobalTimeDilation을 위해 포함
 #include "GameFramework/PlayerController.h" 
-#include "Components/AudioComponent.h" // UAudioComponent 사용을 위한 헤더 추가
-#include "Sound/SoundCue.h" // USoundCue 사용을 위한 헤더 (필요시)
-#include "Sound/SoundWave.h" // USoundWave 사용을 위한 헤더 (필요시)
-
-// FPostProcessSettings를 사용하기 위해 필요한 헤더
-#include "Engine/PostProcessVolume.h" // UCameraComponent.h에 FPostProcessSettings가 이미 포함되어 있을 가능성이 높습니다.
+#include "LedgeQueryComponent.h"
+#include "ClimbingMovementComponent.h"
+#include "TimeDilationSubsystem.h"
+#include "CharacterSignificanceSubsystem.h"
+#include "IAnimationBudgetAllocator.h"
+#include "SkeletalMeshComponentBudgeted.h"
+#include "ScreenEffectSubsystem.h"
+#include "EffectPoolSubsystem.h"
+#include "InputLatencySubsystem.h"
+#include "InputReplaySubsystem.h"
+#include "Curves/CurveFloat.h"
+#include "Engine/AssetManager.h"
+#include "Misc/PackageName.h"
+#include "UObject/ObjectSaveContext.h"
+#include "Misc/ScopeRWLock.h"
 
 
 // 기존 로그 카테고리 정의
 DEFINE_LOG_CATEGORY(LogTemplateCharacter);
 
+const FPrimaryAssetType ATestProject2Character::PrimaryAssetType = TEXT("TestProject2Character");
+
 //////////////////////////////////////////////////////////////////////////
 // ATestProject2Character
 
-ATestProject2Character::ATestProject2Character()
+ATestProject2Character::ATestProject2Character(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer
+		.SetDefaultSubobjectClass<UClimbingMovementComponent>(ACharacter::CharacterMovementComponentName)
+		.SetDefaultSubobjectClass<USkeletalMeshComponentBudgeted>(ACharacter::MeshComponentName))
 {
+	ClimbingMovement = CastChecked<UClimbingMovementComponent>(GetCharacterMovement());
+
+	// 애니메이션 틱은 Animation Budget Allocator 가 중요도에 따라 나눔 (중요도는 UCharacterSignificanceSubsystem 에서 전달)
+	if (USkeletalMeshComponentBudgeted* BudgetedMesh = Cast<USkeletalMeshComponentBudgeted>(GetMesh()))
+	{
+		BudgetedMesh->SetAutoCalculateSignificance(false);
+	}
+
 	// Set size for collision capsule
 	GetCapsuleComponent()->InitCapsuleSize(42.f, 96.0f);
 
@@ -52,6 +74,7 @@ ATestProject2Character::ATestProject2Character()
 	GetCharacterMovement()->BrakingDecelerationWalking = 2000.f;
 	GetCharacterMovement()->BrakingDecelerationFalling = 1500.0f;
 
+#if !UE_SERVER
 	// Create a camera boom (pulls in towards the player if there is a collision)
 	CameraBoom = CreateDefaultSubobject<USpringArmComponent>(TEXT("CameraBoom"));
 	CameraBoom->SetupAttachment(RootComponent);
@@ -62,67 +85,109 @@ ATestProject2Character::ATestProject2Character()
 	FollowCamera = CreateDefaultSubobject<UCameraComponent>(TEXT("FollowCamera"));
 	FollowCamera->SetupAttachment(CameraBoom, USpringArmComponent::SocketName); // Attach the camera to the end of the boom and let the boom adjust to match the controller orientation
 	FollowCamera->bUsePawnControlRotation = false; // Camera does not rotate relative to arm
+#else
+	// 서버 타깃에는 카메라가 없음 (GetCameraBoom / GetFollowCamera 는 nullptr)
+	CameraBoom = nullptr;
+	FollowCamera = nullptr;
+#endif
 
 	// "올라가기" 관련 변수 초기화
 	ClimbTraceOffset = FVector(0.0f, 0.0f, GetCapsuleComponent()->GetScaledCapsuleHalfHeight());
 	ClimbTraceDistance = 150.0f;
 	ClimbSpeed = 250.0f; // ClimbSpeed는 이제 사용하지 않습니다. (아래 Tick 함수에서 Velocity 설정 로직 삭제)
 	bIsClimbing = false;
-	ClimbTargetLocation = FVector::ZeroVector;
+	bIsLaunched = false;
+	bClimbRequestPending = false;
+	bPresentationEffectsEnabled = true;
 
-	ClimbMontageRef = nullptr; // 블루프린트에서 할당
-	StartClimbLocation = FVector::ZeroVector;
-	MontageStartTime = 0.0f;
-	MontageTotalLength = 600.0f;
+	// 전방 레지 비동기 조회 컴포넌트
+	LedgeQuery = CreateDefaultSubobject<ULedgeQueryComponent>(TEXT("LedgeQuery"));
+
+	// ClimbMontageRef / ClimbZOffsetCurve 는 블루프린트에서 할당 (소프트 참조라 CDO 와 함께 로드되지 않음)
+	ClimbDuration = 1.0f;
 	bMontageAlreadyPlayingOnClimb = false;
 
 	// =============== 슬로우 모션 변수 초기화 시작 (protected 멤버이므로 생성자에서 초기화 가능) ===============
 	bIsSlowMotionActive = false;
 	SlowMotionTimeDilationTarget = 0.2f; // 기본 슬로우 모션 속도 (20%)
-	SlowMotionTransitionSpeed = 2.0f;    // 기본 전환 속도
+	SlowMotionPriority = 0;              // 전환 속도 / 커브는 UTimeDilationSubsystem 설정 (DefaultGame.ini)
 
 	// 흑백화를 위한 변수 초기화
 	SlowMotionTargetSaturation = 0.0f; // 0.0f = 완전 흑백, 1.0f = 정상 컬러
-	SlowMotionSaturationTransitionSpeed = 3.0f; // 채도 전환 속도
 	// =============== 슬로우 모션 변수 초기화 끝 ===============
 
-	// UCameraComponent의 PostProcessSettings 활성화 관련 설정
-	// 생성자에서는 개별 PostProcessSettings 오버라이드 플래그를 설정하지 않습니다.
-	// 이는 UpdateSlowMotionDilationAndSaturation 함수 내에서 동적으로 제어됩니다.
-	// 만약 카메라 컴포넌트가 PostProcess설정을 사용하도록 기본적으로 활성화해야 한다면,
-	// UCameraComponent의 PostProcessSettings 구조체의 멤버인 bOverride_* 플래그들을 기본값으로 설정할 수 있습니다.
-	// 하지만, 현재 오류를 해결하기 위해 여기서는 아무것도 설정하지 않습니다.
-
-	// =============== BGM_AudioComponent 초기화 시작 ===============
-	BGM_AudioComponent = CreateDefaultSubobject<UAudioComponent>(TEXT("BGM_AudioComponent"));
-	BGM_AudioComponent->SetupAttachment(RootComponent); // 캐릭터의 루트 컴포넌트에 부착
-	BGM_AudioComponent->bAutoActivate = false; // 기본적으로 자동 재생 끄기 (BeginPlay에서 수동 재생)
-	//BGM_AudioComponent->SetUISound(true); // UI 사운드로 설정하여 시간 딜레이의 영향을 받지 않도록 함 (BGM 목적)
-	BGM_AudioComponent->SetVolumeMultiplier(1.0f); // 초기 볼륨 1.0f
-	BGM_AudioComponent->SetPitchMultiplier(1.0f); // 초기 피치 1.0f (슬로우 모션 시 피치 변경을 원치 않으므로)
-
-	BGM_Sound = nullptr; // 블루프린트에서 할당될 사운드
-	BGM_SlowMotionVolumeTarget = 0.5f; // 슬로우 모션 시 BGM 목표 볼륨
-	BGM_VolumeTransitionSpeed = 5.0f; // BGM 볼륨 전환 속도
-	OriginalBGMVolume = 1.0f; // 원래 BGM 볼륨을 1.0으로 초기화
-	// =============== BGM_AudioComponent 초기화 끝 ===============
+	// 흑백화는 카메라의 PostProcessSettings 가 아니라 UScreenEffectSubsystem 의 "SlowMotion" 레이어에서 처리
 }
 
 void ATestProject2Character::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// BGM_AudioComponent에 사운드가 할당되어 있다면 재생
-	if (BGM_AudioComponent && BGM_Sound)
+	// 게임 모드가 "Climb" 번들을 미리 로드했으면 바로 적용, 아니면 여기서 비동기 로드
+	RequestClimbAssets();
+
+	// 블루프린트에서 튜닝된 레이캐스트 설정을 레지 쿼리에 전달
+	LedgeQuery->SetProbeShape(ClimbTraceOffset, ClimbTraceDistance);
+	LedgeQuery->OnLedgeQueryUpdated.AddUObject(this, &ATestProject2Character::OnLedgeQueryUpdated);
+
+#if !UE_SERVER
+	// 슬로우 모션 전환은 서브시스템이 프레임당 한 번 계산하고 가중치만 전달
+	if (UTimeDilationSubsystem* TimeDilation = GetWorld()->GetSubsystem<UTimeDilationSubsystem>())
 	{
-		BGM_AudioComponent->SetSound(BGM_Sound);
-		BGM_AudioComponent->Play();
-		OriginalBGMVolume = BGM_AudioComponent->VolumeMultiplier; // 현재 볼륨을 원본으로 저장
+		TimeDilation->OnSlowMotionWeightChanged.AddUObject(this, &ATestProject2Character::OnSlowMotionWeightChanged);
 	}
-	else
+
+	// 흑백화 레이어는 설정을 한 번만 적용하고 이후에는 가중치만 바꿈 (이미 등록돼 있으면 그대로 사용)
+	if (UScreenEffectSubsystem* ScreenEffects = GetWorld()->GetSubsystem<UScreenEffectSubsystem>())
+	{
+		FPostProcessSettings Desaturate;
+		Desaturate.bOverride_ColorSaturation = true;
+		Desaturate.ColorSaturation = FVector4(SlowMotionTargetSaturation, SlowMotionTargetSaturation, SlowMotionTargetSaturation, 1.0f);
+		ScreenEffects->RegisterLayer(SlowMotionScreenLayer, Desaturate);
+	}
+#endif
+
+	// 데디케이티드 서버는 메시를 그리지 않으므로 포즈를 갱신하지 않음 (올라가기는 몽타주 없이 PhysClimb 로만 진행)
+	if (IsNetMode(NM_DedicatedServer))
+	{
+		GetMesh()->VisibilityBasedAnimTickOption = EVisibilityBasedAnimTickOption::OnlyTickPoseWhenRendered;
+	}
+
+	UpdatePresentationComponents();
+
+	// 거리 / 화면 밖 여부에 따른 틱, 애니메이션, 레지 프로브 예산
+	if (UCharacterSignificanceSubsystem* Significance = GetWorld()->GetSubsystem<UCharacterSignificanceSubsystem>())
+	{
+		Significance->RegisterCharacter(this);
+	}
+}
+
+void ATestProject2Character::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (bIsClimbing)
+	{
+		DEC_DWORD_STAT(STAT_TP2_ActiveClimbers);
+		--TestProject2Csv::ActiveClimbers;
+	}
+
+	if (ClimbAssetsHandle.IsValid())
+	{
+		ClimbAssetsHandle->CancelHandle();
+		ClimbAssetsHandle.Reset();
+	}
+
+	if (UTimeDilationSubsystem* TimeDilation = GetWorld()->GetSubsystem<UTimeDilationSubsystem>())
+	{
+		TimeDilation->OnSlowMotionWeightChanged.RemoveAll(this);
+		TimeDilation->ReleaseSlowMotion(this);
+	}
+
+	if (UCharacterSignificanceSubsystem* Significance = GetWorld()->GetSubsystem<UCharacterSignificanceSubsystem>())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("BGM_AudioComponent or BGM_Sound not set. BGM will not play."));
+		Significance->UnregisterCharacter(this);
 	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 
@@ -141,6 +206,24 @@ void ATestProject2Character::NotifyControllerChanged()
 			Subsystem->AddMappingContext(DefaultMappingContext, 0);
 		}
 	}
+
+	// 빙의 전에 시작된 슬로우 모션도 화면 효과에 반영
+	if (const UTimeDilationSubsystem* TimeDilation = GetWorld()->GetSubsystem<UTimeDilationSubsystem>())
+	{
+		OnSlowMotionWeightChanged(TimeDilation->GetSlowMotionWeight());
+	}
+
+	UpdatePresentationComponents();
+}
+
+void ATestProject2Character::UpdatePresentationComponents()
+{
+#if !UE_SERVER
+	// 카메라는 이 캐릭터를 조종하는 로컬 플레이어만 사용 (서버 / 시뮬레이티드 프록시 / AI 에서는 붐 충돌 프로브와 카메라를 끔)
+	const bool bLocalView = IsLocalPlayerControlled();
+	CameraBoom->SetComponentTickEnabled(bLocalView && bPresentationEffectsEnabled);
+	FollowCamera->SetActive(bLocalView);
+#endif
 }
 
 void ATestProject2Character::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)
@@ -149,8 +232,8 @@ void ATestProject2Character::SetupPlayerInputComponent(UInputComponent* PlayerIn
 	if (UEnhancedInputComponent* EnhancedInputComponent = Cast<UEnhancedInputComponent>(PlayerInputComponent)) {
 
 		// Jumping
-		EnhancedInputComponent->BindAction(JumpAction, ETriggerEvent::Started, this, &ACharacter::Jump);
-		EnhancedInputComponent->BindAction(JumpAction, ETriggerEvent::Completed, this, &ACharacter::StopJumping);
+		EnhancedInputComponent->BindAction(JumpAction, ETriggerEvent::Started, this, &ATestProject2Character::OnJumpInput);
+		EnhancedInputComponent->BindAction(JumpAction, ETriggerEvent::Completed, this, &ATestProject2Character::OnJumpReleased);
 
 		// Moving
 		EnhancedInputComponent->BindAction(MoveAction, ETriggerEvent::Triggered, this, &ATestProject2Character::Move);
@@ -159,12 +242,12 @@ void ATestProject2Character::SetupPlayerInputComponent(UInputComponent* PlayerIn
 		EnhancedInputComponent->BindAction(LookAction, ETriggerEvent::Triggered, this, &ATestProject2Character::Look);
 
 		// "올라가기" 액션 바인딩
-		EnhancedInputComponent->BindAction(ClimbAction, ETriggerEvent::Started, this, &ATestProject2Character::TryClimb);
+		EnhancedInputComponent->BindAction(ClimbAction, ETriggerEvent::Started, this, &ATestProject2Character::OnClimbInput);
 
 		// =============== 슬로우 모션 토글 바인딩 시작 ===============
 		if (ToggleSlowMotionAction)
 		{
-			EnhancedInputComponent->BindAction(ToggleSlowMotionAction, ETriggerEvent::Started, this, &ATestProject2Character::ToggleSlowMotion);
+			EnhancedInputComponent->BindAction(ToggleSlowMotionAction, ETriggerEvent::Started, this, &ATestProject2Character::OnToggleSlowMotionInput);
 		}
 		// =============== 슬로우 모션 토글 바인딩 끝 ===============
 	}
@@ -174,8 +257,67 @@ void ATestProject2Character::SetupPlayerInputComponent(UInputComponent* PlayerIn
 	}
 }
 
+void ATestProject2Character::MarkInputLatency(EInputLatencyAction Action) const
+{
+	if (UInputLatencySubsystem* Latency = GetWorld()->GetSubsystem<UInputLatencySubsystem>())
+	{
+		Latency->MarkInput(Action, this);
+	}
+}
+
+void ATestProject2Character::RecordInput(EInputReplayAction Action, const FVector2D& Value) const
+{
+	if (UInputReplaySubsystem* Replay = GetWorld()->GetSubsystem<UInputReplaySubsystem>())
+	{
+		Replay->RecordInput(this, Action, Value);
+	}
+}
+
+void ATestProject2Character::ApplyReplayedInput(EInputReplayAction Action, const FVector2D& Value)
+{
+	switch (Action)
+	{
+	case EInputReplayAction::Move:				Move(FInputActionValue(Value)); break;
+	case EInputReplayAction::Look:				Look(FInputActionValue(Value)); break;
+	case EInputReplayAction::JumpStarted:		OnJumpInput(); break;
+	case EInputReplayAction::JumpCompleted:		OnJumpReleased(); break;
+	case EInputReplayAction::Climb:				OnClimbInput(); break;
+	case EInputReplayAction::ToggleSlowMotion:	OnToggleSlowMotionInput(); break;
+	default: break;
+	}
+}
+
+void ATestProject2Character::OnJumpInput()
+{
+	RecordInput(EInputReplayAction::JumpStarted, FVector2D::ZeroVector);
+	Jump();
+}
+
+void ATestProject2Character::OnJumpReleased()
+{
+	RecordInput(EInputReplayAction::JumpCompleted, FVector2D::ZeroVector);
+	StopJumping();
+}
+
+void ATestProject2Character::OnClimbInput()
+{
+	MarkInputLatency(EInputLatencyAction::Climb);
+	RecordInput(EInputReplayAction::Climb, FVector2D::ZeroVector);
+	TryClimb();
+}
+
+void ATestProject2Character::OnToggleSlowMotionInput()
+{
+	MarkInputLatency(EInputLatencyAction::SlowMotion);
+	RecordInput(EInputReplayAction::ToggleSlowMotion, FVector2D::ZeroVector);
+	ToggleSlowMotion();
+}
+
 void ATestProject2Character::Move(const FInputActionValue& Value)
 {
+	MarkInputLatency(EInputLatencyAction::Move);
+	RecordInput(EInputReplayAction::Move, Value.Get<FVector2D>());
+
 	// input is a Vector2D
 	FVector2D MovementVector = Value.Get<FVector2D>();
 
@@ -205,6 +347,9 @@ void ATestProject2Character::Move(const FInputActionValue& Value)
 
 void ATestProject2Character::Look(const FInputActionValue& Value)
 {
+	MarkInputLatency(EInputLatencyAction::Look);
+	RecordInput(EInputReplayAction::Look, Value.Get<FVector2D>());
+
 	// input is a Vector2D
 	// ===== F2D 대신 FVector2D를 사용합니다. (이전 오류 해결) =====
 	FVector2D LookAxisVector = Value.Get<FVector2D>();
@@ -220,209 +365,292 @@ void ATestProject2Character::Look(const FInputActionValue& Value)
 
 void ATestProject2Character::TryClimb()
 {
-	UE_LOG(LogTemp, Warning, TEXT("TryClimb function entered. bIsClimbing: %s"), bIsClimbing ? TEXT("True") : TEXT("False"));
+	TP2_SCOPE_CYCLE_COUNTER(STAT_TP2_TryClimb);
+
 	if (bIsClimbing)
 	{
 		return;
 	}
 
-	FVector StartLocation = GetActorLocation() + GetActorForwardVector() * ClimbTraceOffset.X + FVector(0.0f, 0.0f, ClimbTraceOffset.Z);
-	FVector EndLocation = StartLocation + GetActorForwardVector() * ClimbTraceDistance;
-	FHitResult HitResult;
-	FCollisionQueryParams Params;
-	Params.AddIgnoredActor(this); // 자기 자신은 무시
-
-	// Line Trace 수행
-	bool bHit = GetWorld()->LineTraceSingleByChannel(
-		HitResult,
-		StartLocation,
-		EndLocation,
-		ECC_Visibility, // 또는 원하는 Collision Channel
-		Params
-	);
-
-	// 디버깅용 Line Trace 그리기
-	DrawDebugLine(GetWorld(), StartLocation, EndLocation, bHit ? FColor::Green : FColor::Red, false, 0.1f);
-
-	if (bHit && HitResult.GetActor() && HitResult.GetActor()->Tags.Contains(FName("Climbable")))
+	// 정지 후 첫 입력처럼 현재 위치 기준 결과가 없으면 다음 프레임 결과로 처리 (게임 스레드에서 트레이스하지 않음)
+	if (!LedgeQuery->IsLatestResultCurrent())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("올라갈 수 있는 오브젝트 (%s) 를 발견했습니다."), *HitResult.GetActor()->GetName());
-
-		ClimbTargetLocation = HitResult.ImpactPoint + FVector(0.0f, 0.0f, GetCapsuleComponent()->GetScaledCapsuleHalfHeight() + 10.0f); // 10.0f는 튜닝 필요
+		bClimbRequestPending = true;
+		LedgeQuery->RequestProbe();
+		return;
+	}
 
-		// 클라이밍 시작 시점의 위치 저장
-		StartClimbLocation = GetActorLocation();
+	const FLedgeQueryResult& Ledge = LedgeQuery->GetLatestResult();
+	if (Ledge.bIsClimbable)
+	{
+		// 레지 윗면에 캡슐이 놓이는 위치를 목표로 사용 (고정 오프셋 대신 실제 높이)
+		// 이동 컴포넌트가 다음 이동에서 올라가기 모드로 전환하고, 같은 요청이 서버로 전달됨
+		ClimbingMovement->RequestClimb(Ledge.MantleTargetLocation);
+	}
+}
 
-		bIsClimbing = true;
-		GetCharacterMovement()->SetMovementMode(EMovementMode::MOVE_Flying); // 비행 모드 유지
-		GetCharacterMovement()->StopMovementImmediately(); // 즉시 이동 정지
+UCurveFloat* ATestProject2Character::GetClimbZOffsetCurve() const
+{
+	return ClimbZOffsetCurve.Get();
+}
 
-		// 몽타주 재생 (C++에서 직접 호출)
-		UAnimInstance* AnimInstance = GetMesh() ? GetMesh()->GetAnimInstance() : nullptr;
-		if (AnimInstance && ClimbMontageRef)
-		{
-			if (AnimInstance->Montage_IsPlaying(ClimbMontageRef)) // 몽타주가 이미 재생 중인 경우
-			{
-				AnimInstance->Montage_Stop(0.0f, ClimbMontageRef); // 기존 몽타주 정지 후 새로 재생
-				bMontageAlreadyPlayingOnClimb = true;
-			}
-			else
-			{
-				bMontageAlreadyPlayingOnClimb = false;
-			}
-			AnimInstance->Montage_Play(ClimbMontageRef, 1.0f); // 1.0f 속도로 재생
-			MontageStartTime = GetWorld()->GetTimeSeconds(); // 몽타주 재생 시작 시간 기록
-			MontageTotalLength = ClimbMontageRef->GetPlayLength(); // 몽타주 총 길이 기록
-			UE_LOG(LogTemp, Warning, TEXT("Montage Play Called from C++! Total Length: %f"), MontageTotalLength);
-		}
-		else
+void ATestProject2Character::RequestClimbAssets()
+{
+	TArray<FSoftObjectPath> Assets;
+	for (const FSoftObjectPath& Path : { ClimbMontageRef.ToSoftObjectPath(), ClimbZOffsetCurve.ToSoftObjectPath() })
+	{
+		if (!Path.IsNull())
 		{
-			UE_LOG(LogTemp, Error, TEXT("Failed to play montage! Mesh, AnimInstance or ClimbMontageRef is null."));
+			Assets.Add(Path);
 		}
 	}
-	else
+
+	if (Assets.Num() == 0)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Raycast X"));
+		return;
 	}
+
+	// 이미 상주 중이면 핸들이 즉시 완료되고 델리게이트도 바로 호출됨
+	ClimbAssetsHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(Assets, FStreamableDelegate::CreateUObject(this, &ATestProject2Character::OnClimbAssetsLoaded));
 }
 
-// =============== 슬로우 모션 토글 함수 시작 ===============
-void ATestProject2Character::ToggleSlowMotion()
+void ATestProject2Character::OnClimbAssetsLoaded()
 {
-	bIsSlowMotionActive = !bIsSlowMotionActive; // 슬로우 모션 상태 토글
+	ClimbingMovement->SetClimbZOffsetCurve(ClimbZOffsetCurve.Get());
+}
 
-	// 기존 타이머가 있다면 클리어
-	GetWorldTimerManager().ClearTimer(SlowMotionTimerHandle);
+FPrimaryAssetId ATestProject2Character::GetPrimaryAssetId() const
+{
+	// 블루프린트 캐릭터 클래스의 CDO 만 주 에셋 (이름은 블루프린트 패키지 이름)
+	if (HasAnyFlags(RF_ClassDefaultObject) && !GetClass()->HasAnyClassFlags(CLASS_Native))
+	{
+		return FPrimaryAssetId(PrimaryAssetType, FPackageName::GetShortFName(GetOutermost()->GetFName()));
+	}
+	return Super::GetPrimaryAssetId();
+}
+
+#if WITH_EDITORONLY_DATA
+void ATestProject2Character::PreSave(FObjectPreSaveContext ObjectSaveContext)
+{
+	Super::PreSave(ObjectSaveContext);
 
-	// 새 타이머 시작 (UpdateSlowMotionDilationAndSaturation 함수를 반복 호출)
-	GetWorldTimerManager().SetTimer(
-		SlowMotionTimerHandle,
-		this,
-		&ATestProject2Character::UpdateSlowMotionDilationAndSaturation,
-		0.01f, // 업데이트 주기
-		true    // 루핑
-	);
+	// UPrimaryDataAsset 과 같은 방식으로 AssetBundles 메타데이터를 번들 데이터로 기록
+	if (HasAnyFlags(RF_ClassDefaultObject) && UAssetManager::IsInitialized())
+	{
+		AssetBundleData.Reset();
+		UAssetManager::Get().InitializeAssetBundlesFromMetadata(this, AssetBundleData);
+	}
 }
+#endif
 
-// =============== 시간 딜레이와 채도 업데이트 함수 시작 ===============
-void ATestProject2Character::UpdateSlowMotionDilationAndSaturation()
+void ATestProject2Character::OnMovementModeChanged(EMovementMode PrevMovementMode, uint8 PreviousCustomMode)
 {
-	// 1. 글로벌 시간 딜레이 조절
-	float CurrentDilation = UGameplayStatics::GetGlobalTimeDilation(this);
-	float TargetDilation = bIsSlowMotionActive ? SlowMotionTimeDilationTarget : 1.0f;
+	Super::OnMovementModeChanged(PrevMovementMode, PreviousCustomMode);
 
-	float NewDilation = FMath::FInterpTo(CurrentDilation, TargetDilation, GetWorld()->GetDeltaSeconds(), SlowMotionTransitionSpeed);
-	UGameplayStatics::SetGlobalTimeDilation(this, NewDilation);
+	const bool bWasClimbing = PrevMovementMode == MOVE_Custom && PreviousCustomMode == CMOVE_Climb;
+	bIsClimbing = ClimbingMovement->IsClimbing();
 
-	// 2. UCameraComponent의 Post Process 채도 조절
-	if (FollowCamera) // FollowCamera가 유효한지 확인
+	if (bIsClimbing && !bWasClimbing)
 	{
-		FPostProcessSettings& CameraPPSettings = FollowCamera->PostProcessSettings; // 참조로 가져와서 바로 수정
-		CameraPPSettings.bOverride_ColorSaturation = true;
-		float CurrentSaturation = CameraPPSettings.ColorSaturation.X;
-		float TargetSaturation = bIsSlowMotionActive ? SlowMotionTargetSaturation : 1.0f;
-		float NewSaturation = FMath::FInterpTo(CurrentSaturation, TargetSaturation, GetWorld()->GetDeltaSeconds(), SlowMotionSaturationTransitionSpeed);
-		CameraPPSettings.ColorSaturation = FVector4(NewSaturation, NewSaturation, NewSaturation, 1.0f);
+		INC_DWORD_STAT(STAT_TP2_ActiveClimbers);
+		++TestProject2Csv::ActiveClimbers;
+		LedgeQuery->SetComponentTickEnabled(false); // 클라이밍 중에는 레지 조회 중지
+		PlayClimbMontage();
+		PlayPooledEffect(EPooledEffect::ClimbStart, GetActorLocation());
 	}
-
-	// 3. BGM AudioComponent 볼륨 조절
-	if (BGM_AudioComponent)
+	else if (!bIsClimbing && bWasClimbing)
 	{
-		float CurrentBGMVolume = BGM_AudioComponent->VolumeMultiplier;
-		float TargetBGMVolume = bIsSlowMotionActive ? BGM_SlowMotionVolumeTarget : OriginalBGMVolume; // 슬로우 모션 중이 아닐 때는 원래 볼륨으로 돌아감
-
-		float NewBGMVolume = FMath::FInterpTo(CurrentBGMVolume, TargetBGMVolume, GetWorld()->GetDeltaSeconds(), BGM_VolumeTransitionSpeed);
-		BGM_AudioComponent->SetVolumeMultiplier(NewBGMVolume);
+		DEC_DWORD_STAT(STAT_TP2_ActiveClimbers);
+		--TestProject2Csv::ActiveClimbers;
+		LedgeQuery->SetComponentTickEnabled(true);
 	}
+}
 
-	// 4. 목표 딜레이, 채도, BGM 볼륨에 거의 도달했으면 타이머 중지
-	bool bIsDilationNearlyEqual = FMath::IsNearlyEqual(NewDilation, TargetDilation, 0.01f);
-	bool bIsSaturationNearlyEqual = true;
-	bool bIsBGMVolumeNearlyEqual = true;
+void ATestProject2Character::Landed(const FHitResult& Hit)
+{
+	Super::Landed(Hit);
 
-	if (FollowCamera)
+	if (bIsLaunched)
 	{
-		float CurrentCameraSaturation = FollowCamera->PostProcessSettings.ColorSaturation.X;
-		float TargetSaturation = bIsSlowMotionActive ? SlowMotionTargetSaturation : 1.0f;
-		bIsSaturationNearlyEqual = FMath::IsNearlyEqual(CurrentCameraSaturation, TargetSaturation, 0.01f);
+		PlayPooledEffect(EPooledEffect::JumpPadLanding, Hit.ImpactPoint);
 	}
+	bIsLaunched = false;
+}
+
+void ATestProject2Character::LaunchCharacter(FVector LaunchVelocity, bool bXYOverride, bool bZOverride)
+{
+	Super::LaunchCharacter(LaunchVelocity, bXYOverride, bZOverride);
 
-	if (BGM_AudioComponent)
+	bIsLaunched = true;
+}
+
+void ATestProject2Character::PublishAnimState()
+{
+	TP2_SCOPE_CYCLE_COUNTER(STAT_TP2_AnimStatePublish);
+
+	FCharacterAnimState NewState;
+	NewState.bIsClimbing = bIsClimbing;
+	NewState.ClimbProgress = ClimbingMovement->GetClimbProgress();
+	NewState.ClimbTargetLocation = ClimbingMovement->GetClimbTargetLocation();
+	NewState.bIsSlowMotionActive = bIsSlowMotionActive;
+	NewState.bIsLaunched = bIsLaunched;
+	NewState.bIsFalling = ClimbingMovement->IsFalling();
+	NewState.Velocity = GetVelocity();
+	NewState.GroundSpeed = NewState.Velocity.Size2D();
+
+	if (const UTimeDilationSubsystem* TimeDilation = GetWorld()->GetSubsystem<UTimeDilationSubsystem>())
 	{
-		float CurrentBGMVolume = BGM_AudioComponent->VolumeMultiplier;
-		float TargetBGMVolume = bIsSlowMotionActive ? BGM_SlowMotionVolumeTarget : OriginalBGMVolume;
-		bIsBGMVolumeNearlyEqual = FMath::IsNearlyEqual(CurrentBGMVolume, TargetBGMVolume, 0.01f);
+		NewState.SlowMotionWeight = TimeDilation->GetSlowMotionWeight();
 	}
 
+	FWriteScopeLock Lock(AnimStateLock);
+	AnimState = NewState;
+}
+
+FCharacterAnimState ATestProject2Character::GetAnimStateSnapshot() const
+{
+	FReadScopeLock Lock(AnimStateLock);
+	return AnimState;
+}
 
-	if (bIsDilationNearlyEqual && bIsSaturationNearlyEqual && bIsBGMVolumeNearlyEqual)
+void ATestProject2Character::PlayClimbMontage()
+{
+	// 몽타주는 연출 전용 (올라가기 시간은 고정된 ClimbDuration 이므로 서버는 재생하지 않음)
+	if (IsNetMode(NM_DedicatedServer))
 	{
-		// 최종적으로 정확한 Dilation 설정
-		UGameplayStatics::SetGlobalTimeDilation(this, TargetDilation);
+		return;
+	}
 
-		// 최종적으로 정확한 채도 설정 (FollowCamera를 통해)
-		if (FollowCamera)
+	// 몽타주 재생 (C++에서 직접 호출)
+	UAnimInstance* AnimInstance = GetMesh() ? GetMesh()->GetAnimInstance() : nullptr;
+	UAnimMontage* ClimbMontage = ClimbMontageRef.Get();
+	if (AnimInstance && ClimbMontage)
+	{
+		if (AnimInstance->Montage_IsPlaying(ClimbMontage)) // 몽타주가 이미 재생 중인 경우
+		{
+			AnimInstance->Montage_Stop(0.0f, ClimbMontage); // 기존 몽타주 정지 후 새로 재생
+			bMontageAlreadyPlayingOnClimb = true;
+		}
+		else
 		{
-			float FinalSaturation = bIsSlowMotionActive ? SlowMotionTargetSaturation : 1.0f;
-			FollowCamera->PostProcessSettings.ColorSaturation = FVector4(FinalSaturation, FinalSaturation, FinalSaturation, 1.0f);
-			if (!bIsSlowMotionActive) // 슬로우 모션이 비활성화될 때만 덮어쓰기 해제
+			bMontageAlreadyPlayingOnClimb = false;
+		}
+		// 몽타주 실제 재생 시간 = 길이 / (재생 속도 * 에셋 RateScale) 이 올라가기 시간과 같도록 재생 속도 결정
+		const float EffectiveLength = ClimbMontage->GetPlayLength() / FMath::Max(ClimbMontage->RateScale, UE_KINDA_SMALL_NUMBER);
+		const float PlayRate = ClimbDuration > UE_KINDA_SMALL_NUMBER ? EffectiveLength / ClimbDuration : 1.0f;
+		AnimInstance->Montage_Play(ClimbMontage, PlayRate);
+
+		if (IsLocalPlayerControlled())
+		{
+			if (UInputLatencySubsystem* Latency = GetWorld()->GetSubsystem<UInputLatencySubsystem>())
 			{
-				FollowCamera->PostProcessSettings.bOverride_ColorSaturation = false;
+				Latency->MarkEffect(EInputLatencyAction::Climb);
 			}
 		}
+	}
+	// 몽타주가 없거나 아직 상주 전이면 이동만 대체 시간으로 진행 (상태는 게임플레이 디버거 TestProject2 카테고리에서 확인)
+}
+
+void ATestProject2Character::OnLedgeQueryUpdated(const FLedgeQueryResult& Result)
+{
+	if (bClimbRequestPending)
+	{
+		bClimbRequestPending = false;
+		TryClimb();
+	}
+}
+
+void ATestProject2Character::ApplySignificance(const FCharacterSignificanceLevel& Level, float Significance)
+{
+	const bool bLocallyControlled = IsLocalPlayerControlled();
 
-		// 최종적으로 정확한 BGM 볼륨 설정
-		if (BGM_AudioComponent)
+	// 로컬 플레이어 캐릭터는 입력 / 예측이 있으므로 틱 간격을 늘리지 않음 (AI 는 권한 측에서 IsLocallyControlled 여도 예산 적용)
+	const float TickInterval = bLocallyControlled ? 0.0f : Level.TickInterval;
+	SetActorTickInterval(TickInterval);
+	GetCharacterMovement()->SetComponentTickInterval(TickInterval);
+
+	LedgeQuery->SetProbeIntervalFrames(Level.LedgeProbeIntervalFrames);
+
+	if (USkeletalMeshComponentBudgeted* BudgetedMesh = Cast<USkeletalMeshComponentBudgeted>(GetMesh()))
+	{
+		if (IAnimationBudgetAllocator* Allocator = IAnimationBudgetAllocator::Get(GetWorld()))
 		{
-			float FinalBGMVolume = bIsSlowMotionActive ? BGM_SlowMotionVolumeTarget : OriginalBGMVolume;
-			BGM_AudioComponent->SetVolumeMultiplier(FinalBGMVolume);
+			Allocator->SetComponentSignificance(BudgetedMesh, Significance, bLocallyControlled);
 		}
+	}
 
-		GetWorldTimerManager().ClearTimer(SlowMotionTimerHandle); // 타이머 중지
+	const bool bPresentation = bLocallyControlled || Level.bPresentationEffects;
+	if (bPresentation != bPresentationEffectsEnabled)
+	{
+		bPresentationEffectsEnabled = bPresentation;
+		UpdatePresentationComponents(); // 카메라 붐 충돌 프로브
 	}
 }
-// =============== 시간 딜레이와 채도 업데이트 함수 끝 ===============
-
 
-void ATestProject2Character::Tick(float DeltaTime)
+// =============== 슬로우 모션 토글 함수 시작 ===============
+void ATestProject2Character::ToggleSlowMotion()
 {
-	Super::Tick(DeltaTime);
+	bIsSlowMotionActive = !bIsSlowMotionActive; // 슬로우 모션 상태 토글
 
-	// Climb 로직은 그대로 유지
-	if (bIsClimbing)
+	UTimeDilationSubsystem* TimeDilation = GetWorld()->GetSubsystem<UTimeDilationSubsystem>();
+	if (TimeDilation == nullptr)
 	{
-		UAnimInstance* AnimInstance = GetMesh() ? GetMesh()->GetAnimInstance() : nullptr;
+		return;
+	}
 
-		if (AnimInstance && ClimbMontageRef && AnimInstance->Montage_IsPlaying(ClimbMontageRef))
-		{
-			float CurrentMontageTime = GetWorld()->GetTimeSeconds() - MontageStartTime;
-			float AnimProgress = FMath::Clamp(CurrentMontageTime / MontageTotalLength, 0.0f, 1.0f);
+	if (bIsSlowMotionActive)
+	{
+		TimeDilation->RequestSlowMotion(this, SlowMotionTimeDilationTarget, SlowMotionPriority);
+	}
+	else
+	{
+		TimeDilation->ReleaseSlowMotion(this);
+	}
 
-			float ZOffsetAlpha = 0.0f;
-			if (ClimbZOffsetCurve) // 커브가 할당되어 있는지 확인
-			{
-				ZOffsetAlpha = ClimbZOffsetCurve->GetFloatValue(AnimProgress);
-			}
+	PlayPooledEffect(bIsSlowMotionActive ? EPooledEffect::SlowMotionEnter : EPooledEffect::SlowMotionExit, GetActorLocation());
+}
 
-			float TargetZ = FMath::Lerp(StartClimbLocation.Z, ClimbTargetLocation.Z, ZOffsetAlpha);
+void ATestProject2Character::PlayPooledEffect(EPooledEffect Effect, const FVector& Location) const
+{
+	// 클라이언트 이동 재실행 중에 다시 불리는 착지 / 모드 변경은 무시
+	if (GetCharacterMovement()->bClientUpdating)
+	{
+		return;
+	}
 
-			FVector NewLocation = FVector(
-				FMath::Lerp(StartClimbLocation.X, ClimbTargetLocation.X, AnimProgress),
-				FMath::Lerp(StartClimbLocation.Y, ClimbTargetLocation.Y, AnimProgress),
-				TargetZ // Z축은 커브를 통해 계산된 값을 사용
-			);
+	if (UEffectPoolSubsystem* Effects = UWorld::GetSubsystem<UEffectPoolSubsystem>(GetWorld()))
+	{
+		Effects->PlayEffect(Effect, Location, GetActorRotation());
+	}
+}
 
-			SetActorLocation(NewLocation, false, nullptr, ETeleportType::TeleportPhysics);
+// =============== 채도 업데이트 함수 시작 ===============
+void ATestProject2Character::OnSlowMotionWeightChanged(float Weight)
+{
+#if !UE_SERVER
+	// 화면 효과 레이어는 월드에 하나이므로 로컬 플레이어 캐릭터만 갱신
+	if (!IsLocalPlayerControlled())
+	{
+		return;
+	}
 
-			GetCharacterMovement()->Velocity = FVector::ZeroVector;
-		}
-		else // 몽타주 재생이 끝났을 때
-		{
-			// 클라이밍 종료
-			bIsClimbing = false;
-			GetCharacterMovement()->SetMovementMode(EMovementMode::MOVE_Walking);
-			SetActorLocation(ClimbTargetLocation); // 마지막으로 정확한 목표 위치로 설정
-			UE_LOG(LogTemp, Warning, TEXT("Climbing Finished, Montage ended."));
-		}
+	TP2_SCOPE_CYCLE_COUNTER(STAT_TP2_SlowMotionListener);
+
+	// 채도 보간은 레이어 블렌딩이 처리하므로 가중치만 전달 (BGM 볼륨은 UMusicSubsystem 에서 처리)
+	if (UScreenEffectSubsystem* ScreenEffects = GetWorld()->GetSubsystem<UScreenEffectSubsystem>())
+	{
+		ScreenEffects->SetLayerWeight(SlowMotionScreenLayer, Weight);
 	}
+#endif
+}
+// =============== 채도 업데이트 함수 끝 ===============
+
+
+void ATestProject2Character::Tick(float DeltaTime)
+{
+	TP2_SCOPE_CYCLE_COUNTER(STAT_TP2_CharacterTick);
+
+	Super::Tick(DeltaTime);
+
+	// 올라가기 이동은 UClimbingMovementComponent::PhysCustom 에서 처리 (예측 / 복제)
 }
\ No newline at end of file
@@ -4,6 +4,8 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Character.h"
+#include "Engine/AssetManagerTypes.h"
+#include "TestProject2AnimInstance.h"
 #include "Logging/LogMacros.h"
 #include "TestProject2Character.generated.h"
 
@@ -12,7 +14,14 @@ class UCameraComponent;
 class UInputMappingContext;
 class UInputAction;
 struct FInputActionValue;
-class UAudioComponent; // UAudioComponent 헤더 추가
+class ULedgeQueryComponent;
+class UClimbingMovementComponent;
+struct FLedgeQueryResult;
+struct FCharacterSignificanceLevel;
+struct FStreamableHandle;
+enum class EInputLatencyAction : uint8;
+enum class EInputReplayAction : uint8;
+enum class EPooledEffect : uint8;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogTemplateCharacter, Log, All);
 
@@ -49,6 +58,14 @@ class ATestProject2Character : public ACharacter
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Input, meta = (AllowPrivateAccess = "true"))
 	UInputAction* ClimbAction;
 
+	/** 전방 레지를 비동기 트레이스로 미리 조회하는 컴포넌트 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Climbing, meta = (AllowPrivateAccess = "true"))
+	ULedgeQueryComponent* LedgeQuery;
+
+	/** 올라가기 이동 모드를 가진 캐릭터 이동 컴포넌트 (GetCharacterMovement() 와 같은 객체) */
+	UPROPERTY(Transient)
+	UClimbingMovementComponent* ClimbingMovement;
+
 protected: // 이 protected 섹션에 슬로우 모션 관련 함수와 기존 protected 멤버들이 위치합니다.
 
 	// =============== 슬로우 모션 및 흑백화 관련 UPROPERTY 추가 부분 시작 ===============
@@ -64,48 +81,38 @@ protected: // 이 protected 섹션에 슬로우 모션 관련 함수와 기존 p
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "SlowMotion")
 	float SlowMotionTimeDilationTarget; // 목표 시간 딜레이 값 (0.2, 1.0)
 
-	/** 슬로우 모션 전환 속도 (Lerp에 사용, 초당 Time Dilation 변화량) */
+	/** 슬로우 모션 요청 우선순위 (UTimeDilationSubsystem 에서 가장 높은 요청이 적용됨) */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "SlowMotion")
-	float SlowMotionTransitionSpeed;
+	int32 SlowMotionPriority;
 
-	/** 슬로우 모션 시 목표 채도 (0.0f = 흑백, 1.0f = 풀컬러) */
+	/** 슬로우 모션 시 목표 채도 (0.0f = 흑백, 1.0f = 풀컬러). 레이어를 처음 등록하는 캐릭터의 값이 쓰임 */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "SlowMotion")
 	float SlowMotionTargetSaturation;
-
-	/** 채도 전환 속도 (Lerp에 사용) */
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "SlowMotion")
-	float SlowMotionSaturationTransitionSpeed;
-
-	/** 슬로우 모션 전환 타이머 핸들 */
-	FTimerHandle SlowMotionTimerHandle;
 	// =============== 슬로우 모션 및 흑백화 관련 UPROPERTY 추가 부분 끝 ===============
 
-	// =============== BGM_AudioComponent 관련 UPROPERTY 추가 시작 ===============
-	/** BGM Audio Component */
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Audio", meta = (AllowPrivateAccess = "true"))
-	UAudioComponent* BGM_AudioComponent;
+	// BGM 은 UMusicSubsystem 에서 게임 인스턴스당 하나만 재생
 
-	/** BGM을 재생할 Sound Cue 또는 Sound Wave (블루프린트에서 할당) */
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Audio")
-	USoundBase* BGM_Sound;
+	/** Called for movement input */
+	void Move(const FInputActionValue& Value);
 
-	/** 슬로우 모션 시 BGM의 목표 볼륨 */
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Audio")
-	float BGM_SlowMotionVolumeTarget;
+	/** Called for looking input */
+	void Look(const FInputActionValue& Value);
 
-	/** BGM 볼륨 전환 속도 (Lerp에 사용) */
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Audio")
-	float BGM_VolumeTransitionSpeed;
+	/** 점프 입력 (녹화 후 Jump / StopJumping) */
+	void OnJumpInput();
+	void OnJumpReleased();
 
-	float OriginalBGMVolume; // 원래 BGM 볼륨을 저장할 변수
-	// =============== BGM_AudioComponent 관련 UPROPERTY 추가 끝 ===============
+	/** "올라가기" 입력 (지연 측정 / 녹화 후 TryClimb) */
+	void OnClimbInput();
 
+	/** 슬로우 모션 토글 입력 (지연 측정 / 녹화 후 ToggleSlowMotion) */
+	void OnToggleSlowMotionInput();
 
-	/** Called for movement input */
-	void Move(const FInputActionValue& Value);
+	/** 입력 지연 측정 시작 (UInputLatencySubsystem, 꺼져 있으면 무시) */
+	void MarkInputLatency(EInputLatencyAction Action) const;
 
-	/** Called for looking input */
-	void Look(const FInputActionValue& Value);
+	/** 입력 녹화 (UInputReplaySubsystem, 녹화 중이 아니면 무시) */
+	void RecordInput(EInputReplayAction Action, const FVector2D& Value) const;
 
 	/** 레이캐스트 시작 위치 오프셋 (캐릭터 기준) */
 	UPROPERTY(EditDefaultsOnly, Category = Climbing)
@@ -119,14 +126,27 @@ protected: // 이 protected 섹션에 슬로우 모션 관련 함수와 기존 p
 	UPROPERTY(EditDefaultsOnly, Category = Climbing)
 	float ClimbSpeed; // 이 값은 현재 Tick에서 사용되지 않음
 
-	/** 올라가는 중인지 여부 */
+	/** 올라가는 중인지 여부 (이동 모드 변경 시 갱신) */
 	bool bIsClimbing;
 
-	/** 올라갈 목표 위치 */
-	FVector ClimbTargetLocation;
+	/** 카메라 붐 갱신 여부 (중요도가 낮으면 꺼짐) */
+	bool bPresentationEffectsEnabled;
 
-	/** "올라가기 시도" 액션 함수 */
-	void TryClimb();
+	/** 로컬 조종 여부 / 중요도에 따라 카메라 붐 틱과 카메라를 켜고 끔 (서버 타깃에서는 아무것도 하지 않음) */
+	void UpdatePresentationComponents();
+
+	/** 레지 쿼리 결과가 아직 없을 때 눌린 "올라가기" 입력 (다음 결과가 수집되면 처리) */
+	bool bClimbRequestPending;
+
+	/** LaunchCharacter 이후 아직 착지하지 않았는지 */
+	bool bIsLaunched;
+
+	/** 애니메이션 워커 스레드에 공개하는 상태 (PublishAnimState 에서만 기록, AnimStateLock 으로 보호) */
+	FCharacterAnimState AnimState;
+	mutable FRWLock AnimStateLock;
+
+	/** 레지 쿼리 결과 수집 시 호출 (대기 중인 "올라가기" 입력 처리) */
+	void OnLedgeQueryUpdated(const FLedgeQueryResult& Result);
 
 	// 블루프린트에서 구현할 수 있는 이벤트
 	UFUNCTION(BlueprintImplementableEvent, Category = "Climbing")
@@ -138,43 +158,115 @@ protected: // 이 protected 섹션에 슬로우 모션 관련 함수와 기존 p
 	virtual void NotifyControllerChanged() override;
 	virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
 
-	/** "올라가기" 몽타주 참조 (블루프린트에서 할당) */
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = Climbing)
-	UAnimMontage* ClimbMontageRef;
+	/** "올라가기" 몽타주 참조 (블루프린트에서 할당). "Climb" 번들로 비동기 프리로드되며, 상주 전에는 대체 시간으로 올라감 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = Climbing, meta = (AssetBundles = "Climb"))
+	TSoftObjectPtr<UAnimMontage> ClimbMontageRef;
 
-	/** 애니메이션 진행률 (0.0 ~ 1.0) 에 따른 Z 오프셋 커브 (블루프린트에서 설정) */
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = Climbing)
-	UCurveFloat* ClimbZOffsetCurve;
+	/** 애니메이션 진행률 (0.0 ~ 1.0) 에 따른 Z 오프셋 커브 (블루프린트에서 설정). 상주 전에는 선형 보간 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = Climbing, meta = (AssetBundles = "Climb"))
+	TSoftObjectPtr<UCurveFloat> ClimbZOffsetCurve;
+
+	/** 올라가기 몽타주 / 커브를 상주시키는 로드 핸들 (캐릭터가 살아 있는 동안 유지) */
+	TSharedPtr<FStreamableHandle> ClimbAssetsHandle;
 
-	// 클라이밍 시작 시점의 캐릭터 위치
-	FVector StartClimbLocation;
+	/** 올라가기 에셋 비동기 로드 요청 (이미 상주 중이면 바로 적용) */
+	void RequestClimbAssets();
 
-	// 몽타주가 시작될 때의 타임 스탬프 (재생 시간을 추적하기 위함)
-	float MontageStartTime;
+	/** 올라가기 에셋이 상주하면 호출 (이동 컴포넌트의 Z 오프셋 테이블 갱신) */
+	void OnClimbAssetsLoaded();
 
-	// 몽타주의 총 길이 (한 번만 계산)
-	float MontageTotalLength;
+#if WITH_EDITORONLY_DATA
+	/** 저장 시 AssetBundles 메타데이터에서 계산한 번들 (에셋 레지스트리 태그로 기록되어 에셋 매니저가 읽음) */
+	UPROPERTY()
+	FAssetBundleData AssetBundleData;
+#endif
+
+	/**
+	 * 올라가기 시간 (초). 몽타주 로드 여부와 관계없이 클라이언트와 서버가 같은 시간으로 예측하도록 고정하며,
+	 * 몽타주는 이 시간에 맞춰 재생 속도를 조정
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = Climbing)
+	float ClimbDuration;
 
 	// 클라이밍 시작 시 몽타주가 이미 재생 중이었는지 (재시작 방지)
 	bool bMontageAlreadyPlayingOnClimb;
 
-	// 슬로우 모션 관련 함수들을 protected 섹션으로 옮깁니다.
-	/** 슬로우 모션 활성화/비활성화 토글 함수 */
-	void ToggleSlowMotion();
+	/** 올라가기 몽타주 재생 (모든 네트워크 역할에서 이동 모드 변경 시 호출) */
+	void PlayClimbMontage();
+
+	/** 올라가기 시작 / 착지 / 슬로우 모션 피드백을 UEffectPoolSubsystem 에서 재생 (서버와 이동 재실행에서는 재생되지 않음) */
+	void PlayPooledEffect(EPooledEffect Effect, const FVector& Location) const;
 
-	/** 시간 딜레이와 채도를 부드럽게 업데이트하는 함수 */
-	void UpdateSlowMotionDilationAndSaturation();
+	/** 슬로우 모션 가중치 (0.0 ~ 1.0) 를 흑백화 화면 효과 레이어에 전달 (UTimeDilationSubsystem 에서 호출) */
+	void OnSlowMotionWeightChanged(float Weight);
 
 	// BeginPlay 오버라이드
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/** 올라가기 모드 진입 / 종료 처리 (몽타주, 레지 조회) */
+	virtual void OnMovementModeChanged(EMovementMode PrevMovementMode, uint8 PreviousCustomMode = 0) override;
+
+	virtual void Landed(const FHitResult& Hit) override;
 
 public: // public 함수들은 그대로 유지
-	ATestProject2Character();
+	ATestProject2Character(const FObjectInitializer& ObjectInitializer);
 
 	/** Returns CameraBoom subobject **/
 	FORCEINLINE class USpringArmComponent* GetCameraBoom() const { return CameraBoom; }
 	/** Returns FollowCamera subobject **/
 	FORCEINLINE class UCameraComponent* GetFollowCamera() const { return FollowCamera; }
+	/** Returns ClimbingMovement subobject **/
+	FORCEINLINE UClimbingMovementComponent* GetClimbingMovement() const { return ClimbingMovement; }
+
+	/** 이 머신의 플레이어가 조종하는 캐릭터인지 (권한 측 AI 도 IsLocallyControlled 는 true 이므로 구분) */
+	bool IsLocalPlayerControlled() const { return IsPlayerControlled() && IsLocallyControlled(); }
+
+	/** UScreenEffectSubsystem 의 흑백화 레이어 이름 */
+	static inline const FName SlowMotionScreenLayer = TEXT("SlowMotion");
+
+	/** 올라가기 몽타주 (아직 로드되지 않았으면 nullptr) */
+	UAnimMontage* GetClimbMontage() const { return ClimbMontageRef.Get(); }
+
+	/** 슬로우 모션 시 목표 채도 */
+	float GetSlowMotionTargetSaturation() const { return SlowMotionTargetSaturation; }
+
+	/** 전방 레지 조회 컴포넌트 */
+	FORCEINLINE ULedgeQueryComponent* GetLedgeQuery() const { return LedgeQuery; }
+
+	/** 에셋 매니저 주 에셋 타입 (블루프린트 캐릭터 클래스를 "Climb" 번들과 함께 관리) */
+	static const FPrimaryAssetType PrimaryAssetType;
+
+	/** 올라가기 Z 오프셋 커브 (아직 로드되지 않았으면 nullptr) */
+	UCurveFloat* GetClimbZOffsetCurve() const;
+
+	virtual FPrimaryAssetId GetPrimaryAssetId() const override;
+#if WITH_EDITORONLY_DATA
+	virtual void PreSave(FObjectPreSaveContext ObjectSaveContext) override;
+#endif
+
+	/** 올라가기에 걸리는 시간 (게임 시간 초) */
+	float GetClimbDuration() const { return ClimbDuration; }
+
+	/** "올라가기 시도" 액션 함수 (입력 바인딩 외에 AI / 자동화 테스트에서도 호출) */
+	void TryClimb();
+
+	/** 슬로우 모션 활성화/비활성화 토글 함수 */
+	void ToggleSlowMotion();
+
+	/** 녹화된 입력을 입력 핸들러와 같은 경로로 적용 (UInputReplaySubsystem 에서 호출) */
+	void ApplyReplayedInput(EInputReplayAction Action, const FVector2D& Value);
+
+	virtual void LaunchCharacter(FVector LaunchVelocity, bool bXYOverride, bool bZOverride) override;
+
+	/** 이동이 끝난 뒤 애니메이션 상태 스냅샷 갱신 (게임 스레드, UClimbingMovementComponent 틱 끝에서 호출) */
+	void PublishAnimState();
+
+	/** 마지막으로 공개된 애니메이션 상태의 복사본 (모든 스레드에서 호출 가능) */
+	FCharacterAnimState GetAnimStateSnapshot() const;
+
+	/** 중요도 단계 적용 (틱 간격, 애니메이션 예산, 레지 프로브 빈도, 연출 갱신). UCharacterSignificanceSubsystem 에서 호출 */
+	void ApplySignificance(const FCharacterSignificanceLevel& Level, float Significance);
 
 	virtual void Tick(float DeltaTime) override;
 };
\ No newline at end of file
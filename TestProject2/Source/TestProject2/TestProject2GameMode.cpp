@@ -1,15 +1,101 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "TestProject2GameMode.h"
+#include "TestProject2.h"
 #include "TestProject2Character.h"
-#include "UObject/ConstructorHelpers.h"
+#include "ShaderWarmupSubsystem.h"
+#include "Engine/AssetManager.h"
+#include "HAL/PlatformTime.h"
 
 ATestProject2GameMode::ATestProject2GameMode()
 {
-	// set default pawn class to our Blueprinted character
-	static ConstructorHelpers::FClassFinder<APawn> PlayerPawnBPClass(TEXT("/Game/ThirdPerson/Blueprints/BP_ThirdPersonCharacter"));
-	if (PlayerPawnBPClass.Class != NULL)
+	// 블루프린트 캐릭터는 클래스 파인더로 하드 로드하지 않고 에셋 매니저로 비동기 로드 (DefaultGame.ini 에서 변경 가능)
+	PlayerPawnAssetId = FPrimaryAssetId(ATestProject2Character::PrimaryAssetType, TEXT("BP_ThirdPersonCharacter"));
+	PlayerPawnBundles.Add(TEXT("Climb"));
+	PreloadStartTime = 0.0;
+}
+
+void ATestProject2GameMode::InitGame(const FString& MapName, const FString& Options, FString& ErrorMessage)
+{
+	Super::InitGame(MapName, Options, ErrorMessage);
+
+	if (UShaderWarmupSubsystem* ShaderWarmup = GetWorld()->GetSubsystem<UShaderWarmupSubsystem>())
+	{
+		ShaderWarmup->OnWarmupFinished.AddUObject(this, &ATestProject2GameMode::OnShaderWarmupFinished);
+	}
+
+	if (!PlayerPawnAssetId.IsValid() || !UAssetManager::IsInitialized())
+	{
+		return;
+	}
+
+	PreloadStartTime = FPlatformTime::Seconds();
+	PlayerPawnHandle = UAssetManager::Get().LoadPrimaryAsset(PlayerPawnAssetId, PlayerPawnBundles, FStreamableDelegate::CreateUObject(this, &ATestProject2GameMode::OnPlayerPawnLoaded));
+	if (!PlayerPawnHandle.IsValid())
+	{
+		// 이미 로드되어 있거나 등록되지 않은 에셋 (스캔 설정 누락) - 후자는 GetDefaultPawnClassForController 에서 기본 폰 사용
+		OnPlayerPawnLoaded();
+	}
+}
+
+void ATestProject2GameMode::OnPlayerPawnLoaded()
+{
+	const TSubclassOf<APawn> PawnClass = UAssetManager::Get().GetPrimaryAssetObjectClass<APawn>(PlayerPawnAssetId);
+	if (PawnClass)
+	{
+		DefaultPawnClass = PawnClass;
+		UE_LOG(LogTestProject2, Log, TEXT("Preloaded %s with bundles in %.1f ms"), *PlayerPawnAssetId.ToString(), (FPlatformTime::Seconds() - PreloadStartTime) * 1000.0);
+	}
+}
+
+UClass* ATestProject2GameMode::GetDefaultPawnClassForController_Implementation(AController* InController)
+{
+	// 첫 플레이어가 프리로드 완료 전에 접속한 경우: 클래스만 동기 로드 (번들은 계속 비동기로 진행, 캐릭터가 대체 시간으로 올라감)
+	if (PlayerPawnAssetId.IsValid() && UAssetManager::IsInitialized() && !UAssetManager::Get().GetPrimaryAssetObjectClass<APawn>(PlayerPawnAssetId))
+	{
+		const FSoftObjectPath PawnPath = UAssetManager::Get().GetPrimaryAssetPath(PlayerPawnAssetId);
+		if (UClass* PawnClass = Cast<UClass>(PawnPath.TryLoad()))
+		{
+			UE_LOG(LogTestProject2, Warning, TEXT("%s was not preloaded before the first player spawned, loading synchronously"), *PlayerPawnAssetId.ToString());
+			DefaultPawnClass = PawnClass;
+		}
+	}
+
+	return Super::GetDefaultPawnClassForController_Implementation(InController);
+}
+
+void ATestProject2GameMode::HandleStartingNewPlayer_Implementation(APlayerController* NewPlayer)
+{
+	// 셰이더 워밍업 (로딩 화면) 이 끝날 때까지 폰을 스폰하지 않음
+	const UShaderWarmupSubsystem* ShaderWarmup = GetWorld()->GetSubsystem<UShaderWarmupSubsystem>();
+	if (ShaderWarmup && ShaderWarmup->IsWarmingUp())
 	{
-		DefaultPawnClass = PlayerPawnBPClass.Class;
+		PlayersWaitingForWarmup.Add(NewPlayer);
+		return;
 	}
+
+	Super::HandleStartingNewPlayer_Implementation(NewPlayer);
+}
+
+void ATestProject2GameMode::OnShaderWarmupFinished()
+{
+	TArray<TWeakObjectPtr<APlayerController>> Players = MoveTemp(PlayersWaitingForWarmup);
+	for (const TWeakObjectPtr<APlayerController>& Player : Players)
+	{
+		if (APlayerController* PlayerController = Player.Get())
+		{
+			Super::HandleStartingNewPlayer_Implementation(PlayerController);
+		}
+	}
+}
+
+void ATestProject2GameMode::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (PlayerPawnHandle.IsValid())
+	{
+		PlayerPawnHandle->CancelHandle();
+		PlayerPawnHandle.Reset();
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
@@ -6,6 +6,8 @@
 #include "GameFramework/GameModeBase.h"
 #include "TestProject2GameMode.generated.h"
 
+struct FStreamableHandle;
+
 UCLASS(minimalapi)
 class ATestProject2GameMode : public AGameModeBase
 {
@@ -13,7 +15,36 @@ class ATestProject2GameMode : public AGameModeBase
 
 public:
 	ATestProject2GameMode();
-};
 
+	virtual void InitGame(const FString& MapName, const FString& Options, FString& ErrorMessage) override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual UClass* GetDefaultPawnClassForController_Implementation(AController* InController) override;
+	virtual void HandleStartingNewPlayer_Implementation(APlayerController* NewPlayer) override;
+
+protected:
+	/**
+	 * 플레이어 캐릭터 블루프린트의 주 에셋 ID (TestProject2Character:BP_ThirdPersonCharacter).
+	 * 클래스와 "Climb" 번들 (올라가기 몽타주 / 커브) 은 InitGame 에서 비동기로 로드됩니다.
+	 */
+	UPROPERTY(config, EditDefaultsOnly, Category = "Classes")
+	FPrimaryAssetId PlayerPawnAssetId;
+
+	/** 프리로드할 에셋 번들 */
+	UPROPERTY(config, EditDefaultsOnly, Category = "Classes")
+	TArray<FName> PlayerPawnBundles;
 
+private:
+	void OnPlayerPawnLoaded();
 
+	/** 셰이더 워밍업이 끝나면 대기 중인 플레이어를 시작 */
+	void OnShaderWarmupFinished();
+
+	/** 로드한 캐릭터 클래스와 번들을 상주시키는 핸들 */
+	TSharedPtr<FStreamableHandle> PlayerPawnHandle;
+
+	/** 프리로드 시작 시각 (로드 시간 로그용) */
+	double PreloadStartTime;
+
+	/** 셰이더 워밍업 중에 접속하여 폰 스폰을 미룬 플레이어 */
+	TArray<TWeakObjectPtr<APlayerController>> PlayersWaitingForWarmup;
+};
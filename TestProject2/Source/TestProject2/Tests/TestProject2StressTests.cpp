@@ -0,0 +1,511 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "TestProject2Character.h"
+#include "AJumpActor.h"
+#include "ClimbableComponent.h"
+#include "ClimbingMovementComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "Dom/JsonObject.h"
+#include "Engine/Engine.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/World.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "UObject/UObjectArray.h"
+
+/**
+ * 헤드리스 스트레스 테스트.
+ * 빈 게임 월드를 직접 만들고 캐릭터 N 명을 스폰한 뒤 고정 델타로 월드를 틱하며 프레임 비용을 측정합니다.
+ *
+ *   Climb   : 캐릭터마다 올라갈 수 있는 박스를 앞에 두고 매 프레임 TryClimb 호출 (올라가면 제자리로 되돌림)
+ *   JumpPad : 점프대 두 개 사이를 캐릭터가 계속 왕복하며, 일정 간격으로 슬로우 모션을 토글
+ *
+ * 결과는 Saved/Automation/StressReports/<Scenario>_<Count>.json 에 기록됩니다.
+ * memoryGrowth 는 측정 구간 전후 프로세스 메모리 / UObject 수의 차이이며 할당 횟수가 아닙니다.
+ * 실행 예:
+ *   UnrealEditor-Cmd TestProject2.uproject -nullrhi -unattended -nosplash -ExecCmds="Automation RunTests TestProject2.Stress; Quit"
+ * 옵션:
+ *   -TP2StressCounts=1,64,512   스폰할 캐릭터 수 목록
+ *   -TP2StressFrames=600        측정 프레임 수 (워밍업 제외)
+ */
+namespace TestProject2Stress
+{
+	constexpr float FixedDeltaSeconds = 1.0f / 60.0f;
+	constexpr int32 WarmupFrames = 60;
+	constexpr int32 DefaultMeasuredFrames = 600;
+	constexpr int32 SlowMotionToggleInterval = 90;
+	constexpr float GridSpacing = 600.0f;
+
+	/** 점프대 발사로 보는 공중 상승 속도 (발사 Z 속도 800 보다 낮고, 단순 낙하 / 되돌림으로는 나오지 않는 값) */
+	constexpr float LaunchRiseSpeed = 400.0f;
+
+	static const TCHAR* CubeMeshPath = TEXT("/Game/LevelPrototyping/Meshes/SM_Cube.SM_Cube");
+	static const TCHAR* CharacterClassPath = TEXT("/Game/ThirdPerson/Blueprints/BP_ThirdPersonCharacter.BP_ThirdPersonCharacter_C");
+
+	static TArray<int32> GetCounts()
+	{
+		TArray<int32> Counts = { 1, 64, 512 };
+
+		FString CountsArg;
+		if (FParse::Value(FCommandLine::Get(), TEXT("TP2StressCounts="), CountsArg, false))
+		{
+			TArray<FString> Parts;
+			CountsArg.ParseIntoArray(Parts, TEXT(","));
+
+			Counts.Reset();
+			for (const FString& Part : Parts)
+			{
+				const int32 Count = FCString::Atoi(*Part);
+				if (Count > 0)
+				{
+					Counts.Add(Count);
+				}
+			}
+		}
+		return Counts;
+	}
+
+	static int32 GetMeasuredFrames()
+	{
+		int32 Frames = DefaultMeasuredFrames;
+		FParse::Value(FCommandLine::Get(), TEXT("TP2StressFrames="), Frames);
+		return FMath::Max(Frames, 1);
+	}
+
+	/** 월드의 StartPhysics ~ EndPhysics 구간 시간을 재기 위한 표식 틱 함수 */
+	struct FPhysicsMarkerTickFunction : public FTickFunction
+	{
+		uint64 Cycles = 0;
+
+		virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override
+		{
+			Cycles = FPlatformTime::Cycles64();
+		}
+
+		virtual FString DiagnosticMessage() override
+		{
+			return TEXT("TestProject2Stress physics marker");
+		}
+	};
+
+	/** 측정 결과 한 묶음 */
+	struct FFrameSamples
+	{
+		TArray<double> GameThreadMs;
+		TArray<double> PhysicsMs;
+
+		static double Average(const TArray<double>& Samples)
+		{
+			double Sum = 0.0;
+			for (const double Sample : Samples)
+			{
+				Sum += Sample;
+			}
+			return Samples.Num() > 0 ? Sum / Samples.Num() : 0.0;
+		}
+
+		static double Percentile(TArray<double> Samples, double Percent)
+		{
+			if (Samples.Num() == 0)
+			{
+				return 0.0;
+			}
+			Samples.Sort();
+			const int32 Index = FMath::Clamp(FMath::CeilToInt32(Percent * Samples.Num()) - 1, 0, Samples.Num() - 1);
+			return Samples[Index];
+		}
+	};
+
+	/**
+	 * 테스트 하나 동안 사용하는 게임 월드.
+	 * 게임 모드와 BeginPlay 까지 진행된 상태로 만들고, 소멸 시 정리합니다.
+	 */
+	class FStressWorld
+	{
+	public:
+		FStressWorld()
+		{
+			World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("TestProject2StressWorld"));
+			FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+			WorldContext.SetCurrentWorld(World);
+
+			const FURL URL;
+			World->SetGameMode(URL);
+			World->InitializeActorsForPlay(URL);
+			World->BeginPlay();
+
+			// 물리 구간 표식: StartPhysics 직전 / EndPhysics 직후
+			PhysicsStartMarker.TickGroup = TG_StartPhysics;
+			PhysicsStartMarker.bCanEverTick = true;
+			PhysicsStartMarker.RegisterTickFunction(World->PersistentLevel);
+			World->StartPhysicsTickFunction.AddPrerequisite(World, PhysicsStartMarker);
+
+			PhysicsEndMarker.TickGroup = TG_EndPhysics;
+			PhysicsEndMarker.bCanEverTick = true;
+			PhysicsEndMarker.RegisterTickFunction(World->PersistentLevel);
+			PhysicsEndMarker.AddPrerequisite(World, World->EndPhysicsTickFunction);
+		}
+
+		~FStressWorld()
+		{
+			World->StartPhysicsTickFunction.RemovePrerequisite(World, PhysicsStartMarker);
+			PhysicsStartMarker.UnRegisterTickFunction();
+			PhysicsEndMarker.UnRegisterTickFunction();
+
+			GEngine->DestroyWorldContext(World);
+			World->DestroyWorld(false);
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		}
+
+		UWorld* Get() const { return World; }
+
+		/** 한 프레임 틱 후 게임 스레드 / 물리 구간 시간 기록 */
+		void TickFrame(FFrameSamples* OutSamples)
+		{
+			// 엔진 루프 대신 월드를 직접 틱하므로 프레임 번호도 직접 진행 (레지 쿼리 결과의 최신 여부 판단에 사용)
+			++GFrameCounter;
+
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			World->Tick(LEVELTICK_All, FixedDeltaSeconds);
+			const uint64 EndCycles = FPlatformTime::Cycles64();
+
+			if (OutSamples)
+			{
+				OutSamples->GameThreadMs.Add(FPlatformTime::ToMilliseconds64(EndCycles - StartCycles));
+				const bool bPhysicsValid = PhysicsEndMarker.Cycles > PhysicsStartMarker.Cycles && PhysicsStartMarker.Cycles >= StartCycles;
+				OutSamples->PhysicsMs.Add(bPhysicsValid ? FPlatformTime::ToMilliseconds64(PhysicsEndMarker.Cycles - PhysicsStartMarker.Cycles) : 0.0);
+			}
+		}
+
+		/** 중심 / 반 크기로 큐브 메쉬 박스를 스폰 */
+		AStaticMeshActor* SpawnBox(UStaticMesh* Mesh, const FVector& Center, const FVector& Extent) const
+		{
+			AStaticMeshActor* Box = World->SpawnActor<AStaticMeshActor>(FVector::ZeroVector, FRotator::ZeroRotator);
+			UStaticMeshComponent* MeshComponent = Box->GetStaticMeshComponent();
+			MeshComponent->SetMobility(EComponentMobility::Movable);
+			MeshComponent->SetStaticMesh(Mesh);
+
+			const FBoxSphereBounds MeshBounds = Mesh->GetBounds();
+			const FVector Scale = Extent / MeshBounds.BoxExtent.ComponentMax(FVector(UE_KINDA_SMALL_NUMBER));
+			Box->SetActorScale3D(Scale);
+			Box->SetActorLocation(Center - MeshBounds.Origin * Scale);
+			return Box;
+		}
+
+		ATestProject2Character* SpawnCharacter(UClass* CharacterClass, const FVector& Location, const FRotator& Rotation) const
+		{
+			FActorSpawnParameters Params;
+			Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+			ATestProject2Character* Character = World->SpawnActor<ATestProject2Character>(CharacterClass, Location, Rotation, Params);
+			if (Character)
+			{
+				// 컨트롤러 없이 이동 컴포넌트를 돌림 (AI 컨트롤러 비용은 측정 대상이 아님)
+				Character->GetCharacterMovement()->bRunPhysicsWithNoController = true;
+			}
+			return Character;
+		}
+
+	private:
+		UWorld* World = nullptr;
+		FPhysicsMarkerTickFunction PhysicsStartMarker;
+		FPhysicsMarkerTickFunction PhysicsEndMarker;
+	};
+
+	static FIntPoint GetGridCell(int32 Index, int32 Count)
+	{
+		const int32 Columns = FMath::Max(1, FMath::CeilToInt32(FMath::Sqrt(static_cast<float>(Count))));
+		return FIntPoint(Index % Columns, Index / Columns);
+	}
+
+	static UClass* LoadCharacterClass()
+	{
+		UClass* CharacterClass = LoadClass<ATestProject2Character>(nullptr, CharacterClassPath);
+		return CharacterClass ? CharacterClass : ATestProject2Character::StaticClass();
+	}
+
+	static void SetJumpPadProperty(AJumpActor* Pad, FName PropertyName, float Value)
+	{
+		if (FFloatProperty* Property = FindFProperty<FFloatProperty>(AJumpActor::StaticClass(), PropertyName))
+		{
+			Property->SetPropertyValue_InContainer(Pad, Value);
+		}
+	}
+
+	static void WriteReport(FAutomationTestBase& Test, const FString& Scenario, int32 Count, const FFrameSamples& Samples,
+		int64 UsedPhysicalGrowth, int32 UObjectGrowth, int32 MeasuredFrames)
+	{
+		TSharedRef<FJsonObject> GameThread = MakeShared<FJsonObject>();
+		GameThread->SetNumberField(TEXT("avg"), FFrameSamples::Average(Samples.GameThreadMs));
+		GameThread->SetNumberField(TEXT("p99"), FFrameSamples::Percentile(Samples.GameThreadMs, 0.99));
+		GameThread->SetNumberField(TEXT("max"), FFrameSamples::Percentile(Samples.GameThreadMs, 1.0));
+
+		TSharedRef<FJsonObject> Physics = MakeShared<FJsonObject>();
+		Physics->SetNumberField(TEXT("avg"), FFrameSamples::Average(Samples.PhysicsMs));
+		Physics->SetNumberField(TEXT("p99"), FFrameSamples::Percentile(Samples.PhysicsMs, 0.99));
+
+		TSharedRef<FJsonObject> MemoryGrowth = MakeShared<FJsonObject>();
+		MemoryGrowth->SetNumberField(TEXT("usedPhysicalKB"), UsedPhysicalGrowth / 1024.0);
+		MemoryGrowth->SetNumberField(TEXT("usedPhysicalBytesPerFrame"), static_cast<double>(UsedPhysicalGrowth) / MeasuredFrames);
+		MemoryGrowth->SetNumberField(TEXT("uobjects"), UObjectGrowth);
+
+		TSharedRef<FJsonObject> Report = MakeShared<FJsonObject>();
+		Report->SetStringField(TEXT("scenario"), Scenario);
+		Report->SetNumberField(TEXT("count"), Count);
+		Report->SetNumberField(TEXT("frames"), MeasuredFrames);
+		Report->SetNumberField(TEXT("fixedDeltaSeconds"), FixedDeltaSeconds);
+		Report->SetStringField(TEXT("configuration"), LexToString(FApp::GetBuildConfiguration()));
+		Report->SetStringField(TEXT("platform"), FPlatformProperties::IniPlatformName());
+		Report->SetObjectField(TEXT("gameThreadMs"), GameThread);
+		Report->SetObjectField(TEXT("physicsMs"), Physics);
+		Report->SetObjectField(TEXT("memoryGrowth"), MemoryGrowth);
+
+		FString Json;
+		const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+		FJsonSerializer::Serialize(Report, Writer);
+
+		const FString ReportPath = FPaths::ProjectSavedDir() / TEXT("Automation/StressReports") / FString::Printf(TEXT("%s_%d.json"), *Scenario, Count);
+		if (!FFileHelper::SaveStringToFile(Json, *ReportPath))
+		{
+			Test.AddError(FString::Printf(TEXT("Failed to write stress report to %s"), *ReportPath));
+			return;
+		}
+
+		Test.AddInfo(FString::Printf(TEXT("%s x%d: game thread avg %.3f ms / p99 %.3f ms, physics avg %.3f ms -> %s"), *Scenario, Count,
+			FFrameSamples::Average(Samples.GameThreadMs), FFrameSamples::Percentile(Samples.GameThreadMs, 0.99), FFrameSamples::Average(Samples.PhysicsMs), *ReportPath));
+	}
+
+	/** 워밍업 후 측정 프레임 동안 PerFrame 을 호출하며 월드를 틱하고 보고서를 기록 */
+	static void RunMeasured(FAutomationTestBase& Test, FStressWorld& StressWorld, const FString& Scenario, int32 Count, TFunctionRef<void(int32 Frame)> PerFrame)
+	{
+		const int32 MeasuredFrames = GetMeasuredFrames();
+
+		for (int32 Frame = 0; Frame < WarmupFrames; ++Frame)
+		{
+			PerFrame(Frame);
+			StressWorld.TickFrame(nullptr);
+		}
+
+		FFrameSamples Samples;
+		Samples.GameThreadMs.Reserve(MeasuredFrames);
+		Samples.PhysicsMs.Reserve(MeasuredFrames);
+
+		const int64 UsedPhysicalBefore = FPlatformMemory::GetStats().UsedPhysical;
+		const int32 UObjectsBefore = GUObjectArray.GetObjectArrayNumMinusAvailable();
+
+		for (int32 Frame = 0; Frame < MeasuredFrames; ++Frame)
+		{
+			PerFrame(WarmupFrames + Frame);
+			StressWorld.TickFrame(&Samples);
+		}
+
+		const int64 UsedPhysicalGrowth = static_cast<int64>(FPlatformMemory::GetStats().UsedPhysical) - UsedPhysicalBefore;
+		const int32 UObjectGrowth = GUObjectArray.GetObjectArrayNumMinusAvailable() - UObjectsBefore;
+
+		WriteReport(Test, Scenario, Count, Samples, UsedPhysicalGrowth, UObjectGrowth, MeasuredFrames);
+	}
+
+	static void AddCountTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands)
+	{
+		for (const int32 Count : GetCounts())
+		{
+			OutBeautifiedNames.Add(FString::FromInt(Count));
+			OutTestCommands.Add(FString::FromInt(Count));
+		}
+	}
+}
+
+// =============== Climb: N 명이 매 프레임 TryClimb ===============
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FTestProject2ClimbStressTest, "TestProject2.Stress.Climb",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+void FTestProject2ClimbStressTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	TestProject2Stress::AddCountTests(OutBeautifiedNames, OutTestCommands);
+}
+
+bool FTestProject2ClimbStressTest::RunTest(const FString& Parameters)
+{
+	using namespace TestProject2Stress;
+
+	const int32 Count = FCString::Atoi(*Parameters);
+	UStaticMesh* CubeMesh = LoadObject<UStaticMesh>(nullptr, CubeMeshPath);
+	if (!TestTrue(TEXT("Count is positive"), Count > 0) || !TestNotNull(TEXT("SM_Cube"), CubeMesh))
+	{
+		return false;
+	}
+
+	FStressWorld StressWorld;
+	UClass* CharacterClass = LoadCharacterClass();
+
+	const FIntPoint LastCell = GetGridCell(Count - 1, Count);
+	const FVector FloorExtent((LastCell.X + 1) * GridSpacing * 0.5f + GridSpacing, (LastCell.Y + 1) * GridSpacing * 0.5f + GridSpacing, 50.0f);
+	StressWorld.SpawnBox(CubeMesh, FVector(FloorExtent.X - GridSpacing, FloorExtent.Y - GridSpacing, -50.0f), FloorExtent);
+
+	TArray<ATestProject2Character*> Characters;
+	TArray<FVector> StartLocations;
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		const FIntPoint Cell = GetGridCell(Index, Count);
+		const FVector Base(Cell.X * GridSpacing, Cell.Y * GridSpacing, 0.0f);
+
+		// 캐릭터 앞 100cm 에 높이 100cm 짜리 레지
+		AStaticMeshActor* Ledge = StressWorld.SpawnBox(CubeMesh, Base + FVector(150.0f, 0.0f, 50.0f), FVector(50.0f, 100.0f, 50.0f));
+		UClimbableComponent* Climbable = NewObject<UClimbableComponent>(Ledge);
+		Climbable->RegisterComponent();
+
+		ATestProject2Character* Character = StressWorld.SpawnCharacter(CharacterClass, Base, FRotator::ZeroRotator);
+		if (!TestNotNull(TEXT("Spawned character"), Character))
+		{
+			return false;
+		}
+
+		const FVector Start = Base + FVector(0.0f, 0.0f, Character->GetCapsuleComponent()->GetScaledCapsuleHalfHeight() + 2.0f);
+		Character->SetActorLocation(Start);
+		Characters.Add(Character);
+		StartLocations.Add(Start);
+	}
+
+	int32 NumClimbs = 0;
+	RunMeasured(*this, StressWorld, TEXT("Climb"), Count, [&](int32 Frame)
+	{
+		for (int32 Index = 0; Index < Characters.Num(); ++Index)
+		{
+			ATestProject2Character* Character = Characters[Index];
+			if (Character->GetClimbingMovement()->IsClimbing())
+			{
+				continue;
+			}
+
+			// 레지 위로 올라갔으면 제자리로 되돌려 다시 올라가게 함
+			if (Character->GetActorLocation().Z > StartLocations[Index].Z + 50.0f)
+			{
+				++NumClimbs;
+				Character->SetActorLocationAndRotation(StartLocations[Index], FRotator::ZeroRotator, false, nullptr, ETeleportType::TeleportPhysics);
+			}
+			Character->TryClimb();
+		}
+	});
+
+	TestTrue(TEXT("At least one character finished a climb"), NumClimbs > 0);
+	return true;
+}
+
+// =============== JumpPad: 점프대 왕복 + 슬로우 모션 토글 ===============
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FTestProject2JumpPadStressTest, "TestProject2.Stress.JumpPad",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+void FTestProject2JumpPadStressTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	TestProject2Stress::AddCountTests(OutBeautifiedNames, OutTestCommands);
+}
+
+bool FTestProject2JumpPadStressTest::RunTest(const FString& Parameters)
+{
+	using namespace TestProject2Stress;
+
+	const int32 Count = FCString::Atoi(*Parameters);
+	UStaticMesh* CubeMesh = LoadObject<UStaticMesh>(nullptr, CubeMeshPath);
+	if (!TestTrue(TEXT("Count is positive"), Count > 0) || !TestNotNull(TEXT("SM_Cube"), CubeMesh))
+	{
+		return false;
+	}
+
+	FStressWorld StressWorld;
+	UWorld* World = StressWorld.Get();
+	UClass* CharacterClass = LoadCharacterClass();
+
+	const FIntPoint LastCell = GetGridCell(Count - 1, Count);
+	const FVector FloorExtent((LastCell.X + 1) * GridSpacing * 0.5f + GridSpacing, (LastCell.Y + 1) * GridSpacing * 0.5f + GridSpacing, 50.0f);
+	StressWorld.SpawnBox(CubeMesh, FVector(FloorExtent.X - GridSpacing, FloorExtent.Y - GridSpacing, -50.0f), FloorExtent);
+
+	// 캐릭터마다 점프대 두 개를 서로 마주보게 배치
+	constexpr float PadSeparation = 400.0f;
+	TArray<ATestProject2Character*> Characters;
+	TArray<FVector> PadLocations;
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		const FIntPoint Cell = GetGridCell(Index, Count);
+		const FVector Base(Cell.X * GridSpacing, Cell.Y * GridSpacing, 0.0f);
+		const FVector Pads[2] = { Base, Base + FVector(PadSeparation, 0.0f, 0.0f) };
+
+		for (int32 PadIndex = 0; PadIndex < 2; ++PadIndex)
+		{
+			// 첫 칸의 점프대 A 는 월드 원점 (= 목표 없음) 이므로 정면 발사로도 맞은편을 향하도록 회전
+			const FTransform PadTransform(FRotator(0.0f, PadIndex * 180.0f, 0.0f), Pads[PadIndex]);
+			AJumpActor* Pad = World->SpawnActorDeferred<AJumpActor>(AJumpActor::StaticClass(), PadTransform);
+			SetJumpPadProperty(Pad, TEXT("JumpLaunchVelocityZ"), 800.0f);
+			SetJumpPadProperty(Pad, TEXT("JumpLaunchVelocityXY"), 400.0f);
+			if (FStructProperty* TargetProperty = FindFProperty<FStructProperty>(AJumpActor::StaticClass(), TEXT("TargetLandingLocation")))
+			{
+				*TargetProperty->ContainerPtrToValuePtr<FVector>(Pad) = Pads[1 - PadIndex];
+			}
+			Pad->FinishSpawning(PadTransform);
+			PadLocations.Add(Pads[PadIndex]);
+		}
+
+		ATestProject2Character* Character = StressWorld.SpawnCharacter(CharacterClass, Base + FVector(0.0f, 0.0f, 200.0f), FRotator::ZeroRotator);
+		if (!TestNotNull(TEXT("Spawned character"), Character))
+		{
+			return false;
+		}
+		Characters.Add(Character);
+	}
+
+	int32 NumGroundResets = 0;
+	int32 NumLaunches = 0;
+	TArray<bool> WasRising;
+	WasRising.Init(false, Characters.Num());
+	RunMeasured(*this, StressWorld, TEXT("JumpPad"), Count, [&](int32 Frame)
+	{
+		if (Frame % SlowMotionToggleInterval == 0)
+		{
+			Characters[0]->ToggleSlowMotion();
+		}
+
+		// 점프대를 벗어나 착지한 캐릭터는 가까운 점프대 위로 되돌림
+		for (int32 Index = 0; Index < Characters.Num(); ++Index)
+		{
+			ATestProject2Character* Character = Characters[Index];
+			const UCharacterMovementComponent* Movement = Character->GetCharacterMovement();
+
+			// 땅을 떠나 빠르게 상승하기 시작한 순간을 발사 한 번으로 집계
+			const bool bRising = Movement->IsFalling() && Movement->Velocity.Z > LaunchRiseSpeed;
+			if (bRising && !WasRising[Index])
+			{
+				++NumLaunches;
+			}
+			WasRising[Index] = bRising;
+
+			if (!Movement->IsMovingOnGround() || !Movement->PendingLaunchVelocity.IsZero())
+			{
+				continue;
+			}
+
+			const FVector Location = Character->GetActorLocation();
+			const FVector& PadA = PadLocations[Index * 2];
+			const FVector& PadB = PadLocations[Index * 2 + 1];
+			const FVector& Nearest = FVector::DistSquared2D(Location, PadA) < FVector::DistSquared2D(Location, PadB) ? PadA : PadB;
+
+			++NumGroundResets;
+			Character->SetActorLocation(Nearest + FVector(0.0f, 0.0f, 200.0f), false, nullptr, ETeleportType::TeleportPhysics);
+		}
+	});
+
+	AddInfo(FString::Printf(TEXT("JumpPad x%d: %d launches, %d ground resets"), Count, NumLaunches, NumGroundResets));
+	TestTrue(TEXT("At least one character was launched by a pad"), NumLaunches > 0);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
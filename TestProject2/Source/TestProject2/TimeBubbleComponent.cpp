@@ -0,0 +1,100 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TimeBubbleComponent.h"
+#include "TimeBubbleSubsystem.h"
+#include "Engine/World.h"
+#include "Net/UnrealNetwork.h"
+
+UTimeBubbleComponent::UTimeBubbleComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+	bAutoActivate = true;
+	SetIsReplicatedByDefault(true);
+
+	Radius = 800.0f;
+	Dilation = 0.2f;
+	bAffectOwner = false;
+	AffectedObjectTypes = { ECC_Pawn, ECC_WorldDynamic };
+	bRegistered = false;
+}
+
+void UTimeBubbleComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(UTimeBubbleComponent, Radius);
+	DOREPLIFETIME(UTimeBubbleComponent, Dilation);
+}
+
+void UTimeBubbleComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (IsActive())
+	{
+		Register();
+	}
+}
+
+void UTimeBubbleComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	Unregister();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UTimeBubbleComponent::Activate(bool bReset)
+{
+	Super::Activate(bReset);
+
+	if (IsActive() && HasBegunPlay())
+	{
+		Register();
+	}
+}
+
+void UTimeBubbleComponent::Deactivate()
+{
+	Super::Deactivate();
+
+	Unregister();
+}
+
+void UTimeBubbleComponent::SetRadius(float NewRadius)
+{
+	Radius = FMath::Max(NewRadius, 0.0f);
+}
+
+void UTimeBubbleComponent::SetDilation(float NewDilation)
+{
+	// 다음 멤버십 갱신에서 바뀐 값이 반영됨
+	Dilation = FMath::Clamp(NewDilation, 0.0f, 1.0f);
+}
+
+void UTimeBubbleComponent::Register()
+{
+	if (bRegistered)
+	{
+		return;
+	}
+
+	if (UTimeBubbleSubsystem* Subsystem = UWorld::GetSubsystem<UTimeBubbleSubsystem>(GetWorld()))
+	{
+		Subsystem->RegisterBubble(this);
+		bRegistered = true;
+	}
+}
+
+void UTimeBubbleComponent::Unregister()
+{
+	if (!bRegistered)
+	{
+		return;
+	}
+
+	if (UTimeBubbleSubsystem* Subsystem = UWorld::GetSubsystem<UTimeBubbleSubsystem>(GetWorld()))
+	{
+		Subsystem->UnregisterBubble(this);
+	}
+	bRegistered = false;
+}
@@ -0,0 +1,63 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "TimeBubbleComponent.generated.h"
+
+/**
+ * 소유 액터 주변 구 안의 액터에만 CustomTimeDilation 을 적용하는 국소 슬로우 모션.
+ * 멤버십 계산과 딜레이 적용은 UTimeBubbleSubsystem 이 모든 버블을 모아서 처리하므로 이 컴포넌트는 틱하지 않습니다.
+ * 글로벌 시간 딜레이를 건드리지 않으므로 데디케이티드 서버에서도 사용할 수 있으며,
+ * 반지름 / 딜레이 / 활성 상태가 복제되어 클라이언트도 같은 멤버십을 계산합니다.
+ */
+UCLASS(ClassGroup = (SlowMotion), meta = (BlueprintSpawnableComponent))
+class TESTPROJECT2_API UTimeBubbleComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UTimeBubbleComponent();
+
+	UFUNCTION(BlueprintCallable, Category = "SlowMotion")
+	void SetRadius(float NewRadius);
+
+	UFUNCTION(BlueprintCallable, Category = "SlowMotion")
+	void SetDilation(float NewDilation);
+
+	float GetRadius() const { return Radius; }
+	float GetDilation() const { return Dilation; }
+	bool ShouldAffectOwner() const { return bAffectOwner; }
+	const TArray<TEnumAsByte<ECollisionChannel>>& GetAffectedObjectTypes() const { return AffectedObjectTypes; }
+
+	virtual void Activate(bool bReset = false) override;
+	virtual void Deactivate() override;
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/** 버블 반지름 (cm) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Replicated, Category = "SlowMotion", meta = (ClampMin = "0.0"))
+	float Radius;
+
+	/** 버블 안 액터의 시간 비율 (여러 버블이 겹치면 가장 느린 값) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Replicated, Category = "SlowMotion", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float Dilation;
+
+	/** 소유 액터도 느려지는지 (기본값: 소유자는 정상 속도) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "SlowMotion")
+	bool bAffectOwner;
+
+	/** 멤버십 오버랩에 사용할 오브젝트 타입 (물리 시뮬레이션은 CustomTimeDilation 의 영향을 받지 않음) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "SlowMotion")
+	TArray<TEnumAsByte<ECollisionChannel>> AffectedObjectTypes;
+
+private:
+	void Register();
+	void Unregister();
+
+	bool bRegistered;
+};
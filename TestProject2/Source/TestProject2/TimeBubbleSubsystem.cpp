@@ -0,0 +1,216 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TimeBubbleSubsystem.h"
+#include "TimeBubbleComponent.h"
+#include "TestProject2.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Algo/Sort.h"
+#include "Algo/Unique.h"
+
+void UTimeBubbleSubsystem::RegisterBubble(UTimeBubbleComponent* Bubble)
+{
+	if (Bubble && !Bubbles.ContainsByPredicate([Bubble](const FBubble& Entry) { return Entry.Component == Bubble; }))
+	{
+		Bubbles.AddDefaulted_GetRef().Component = Bubble;
+	}
+}
+
+void UTimeBubbleSubsystem::UnregisterBubble(UTimeBubbleComponent* Bubble)
+{
+	if (Bubbles.RemoveAll([Bubble](const FBubble& Entry) { return Entry.Component == Bubble; }) > 0)
+	{
+		bMembershipDirty = true;
+	}
+}
+
+float UTimeBubbleSubsystem::GetBubbleDilation(const AActor* Actor) const
+{
+	const FAffectedActor* Entry = Affected.Find(MakeWeakObjectPtr(const_cast<AActor*>(Actor)));
+	return Entry ? Entry->BubbleDilation : 1.0f;
+}
+
+bool UTimeBubbleSubsystem::IsTickable() const
+{
+	return Bubbles.Num() > 0 || Affected.Num() > 0 || bMembershipDirty;
+}
+
+void UTimeBubbleSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	TP2_SCOPE_CYCLE_COUNTER(STAT_TP2_TimeBubbleUpdate);
+
+	if (CollectOverlaps() || bMembershipDirty)
+	{
+		ApplyMembership();
+		bMembershipDirty = false;
+	}
+
+	IssueOverlaps();
+}
+
+bool UTimeBubbleSubsystem::CollectOverlaps()
+{
+	UWorld* World = GetWorld();
+	bool bChanged = false;
+
+	for (int32 Index = Bubbles.Num() - 1; Index >= 0; --Index)
+	{
+		FBubble& Bubble = Bubbles[Index];
+		const UTimeBubbleComponent* Component = Bubble.Component.Get();
+		if (Component == nullptr)
+		{
+			Bubbles.RemoveAtSwap(Index);
+			bChanged = true;
+			continue;
+		}
+
+		if (Component->GetDilation() != Bubble.AppliedDilation)
+		{
+			Bubble.AppliedDilation = Component->GetDilation();
+			bChanged = true;
+		}
+
+		FOverlapDatum OverlapData;
+		if (!Bubble.PendingOverlap.IsValid() || !World->QueryOverlapData(Bubble.PendingOverlap, OverlapData))
+		{
+			// 틱이 건너뛰어 결과가 만료됨. 이전 멤버를 유지하고 다시 발행
+			continue;
+		}
+		Bubble.PendingOverlap = FTraceHandle();
+
+		TArray<TWeakObjectPtr<AActor>> Members;
+		Members.Reserve(OverlapData.OutOverlaps.Num());
+		for (const FOverlapResult& Overlap : OverlapData.OutOverlaps)
+		{
+			if (AActor* Actor = Overlap.GetActor())
+			{
+				Members.Add(Actor);
+			}
+		}
+
+		// 한 액터의 여러 컴포넌트가 겹칠 수 있으므로 정렬 후 중복 제거 (정렬되어 있어 이전 멤버와 바로 비교 가능)
+		Algo::Sort(Members, [](const TWeakObjectPtr<AActor>& A, const TWeakObjectPtr<AActor>& B) { return A.Get() < B.Get(); });
+		Members.SetNum(Algo::Unique(Members));
+
+		if (Members != Bubble.Members)
+		{
+			Bubble.Members = MoveTemp(Members);
+			bChanged = true;
+		}
+	}
+
+	return bChanged;
+}
+
+void UTimeBubbleSubsystem::ApplyMembership()
+{
+	// 액터별 목표 딜레이 (겹치는 버블 중 가장 느린 값)
+	TMap<AActor*, float> Targets;
+	Targets.Reserve(Affected.Num());
+	for (const FBubble& Bubble : Bubbles)
+	{
+		for (const TWeakObjectPtr<AActor>& Member : Bubble.Members)
+		{
+			if (AActor* Actor = Member.Get())
+			{
+				float& Target = Targets.FindOrAdd(Actor, 1.0f);
+				Target = FMath::Min(Target, Bubble.AppliedDilation);
+			}
+		}
+	}
+
+	// 버블을 벗어난 액터 복원
+	for (auto It = Affected.CreateIterator(); It; ++It)
+	{
+		AActor* Actor = It.Key().Get();
+		if (Actor == nullptr)
+		{
+			It.RemoveCurrent();
+		}
+		else if (!Targets.Contains(Actor))
+		{
+			Actor->CustomTimeDilation = It.Value().BaseDilation;
+			It.RemoveCurrent();
+		}
+	}
+
+	// 들어왔거나 딜레이가 바뀐 액터만 갱신
+	for (const TPair<AActor*, float>& Target : Targets)
+	{
+		AActor* Actor = Target.Key;
+		FAffectedActor* Entry = Affected.Find(Actor);
+		if (Entry == nullptr)
+		{
+			Entry = &Affected.Add(Actor);
+			Entry->BaseDilation = Actor->CustomTimeDilation;
+		}
+		else if (Entry->BubbleDilation == Target.Value)
+		{
+			continue;
+		}
+
+		Entry->BubbleDilation = Target.Value;
+		Actor->CustomTimeDilation = Entry->BaseDilation * Target.Value;
+	}
+
+	SET_DWORD_STAT(STAT_TP2_TimeBubbleActors, Affected.Num());
+}
+
+void UTimeBubbleSubsystem::IssueOverlaps()
+{
+	UWorld* World = GetWorld();
+
+	for (FBubble& Bubble : Bubbles)
+	{
+		const UTimeBubbleComponent* Component = Bubble.Component.Get();
+		const AActor* Owner = Component ? Component->GetOwner() : nullptr;
+		if (Owner == nullptr)
+		{
+			continue;
+		}
+
+		FCollisionObjectQueryParams ObjectParams;
+		for (const TEnumAsByte<ECollisionChannel>& ObjectType : Component->GetAffectedObjectTypes())
+		{
+			ObjectParams.AddObjectTypesToQuery(ObjectType);
+		}
+
+		FCollisionQueryParams Params(SCENE_QUERY_STAT(TimeBubble), false);
+		if (!Component->ShouldAffectOwner())
+		{
+			Params.AddIgnoredActor(Owner);
+		}
+
+		Bubble.PendingOverlap = World->AsyncOverlapByObjectType(Owner->GetActorLocation(), FQuat::Identity, ObjectParams,
+			FCollisionShape::MakeSphere(Component->GetRadius()), Params);
+	}
+}
+
+void UTimeBubbleSubsystem::RestoreAll()
+{
+	for (const TPair<TWeakObjectPtr<AActor>, FAffectedActor>& Entry : Affected)
+	{
+		if (AActor* Actor = Entry.Key.Get())
+		{
+			Actor->CustomTimeDilation = Entry.Value.BaseDilation;
+		}
+	}
+	Affected.Reset();
+
+	SET_DWORD_STAT(STAT_TP2_TimeBubbleActors, 0);
+}
+
+void UTimeBubbleSubsystem::Deinitialize()
+{
+	RestoreAll();
+	Bubbles.Reset();
+
+	Super::Deinitialize();
+}
+
+TStatId UTimeBubbleSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UTimeBubbleSubsystem, STATGROUP_Tickables);
+}
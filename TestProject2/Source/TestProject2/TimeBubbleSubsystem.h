@@ -0,0 +1,82 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+#include "TimeBubbleSubsystem.generated.h"
+
+class UTimeBubbleComponent;
+
+/**
+ * 월드의 모든 UTimeBubbleComponent 멤버십을 한 곳에서 계산합니다.
+ * 버블마다 프레임당 한 번 비동기 구 오버랩을 발행하고 다음 틱에 결과를 모으며,
+ * 멤버가 바뀐 경우에만 들어온 / 나간 / 딜레이가 바뀐 액터의 CustomTimeDilation 을 갱신합니다.
+ * 영향받는 액터는 추가 틱 없이 원래 CustomTimeDilation 을 기억했다가 버블을 벗어나면 복원됩니다.
+ * 버블이 없고 복원할 액터도 없으면 틱하지 않습니다.
+ */
+UCLASS()
+class TESTPROJECT2_API UTimeBubbleSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	void RegisterBubble(UTimeBubbleComponent* Bubble);
+	void UnregisterBubble(UTimeBubbleComponent* Bubble);
+
+	/** Actor 에 적용 중인 버블 딜레이 (버블 밖이면 1.0) */
+	float GetBubbleDilation(const AActor* Actor) const;
+
+	/** 버블 안에 있는 액터 수 */
+	int32 GetNumAffectedActors() const { return Affected.Num(); }
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+	virtual void Deinitialize() override;
+
+private:
+	struct FBubble
+	{
+		TWeakObjectPtr<UTimeBubbleComponent> Component;
+
+		/** 지난 틱에 발행한 오버랩 */
+		FTraceHandle PendingOverlap;
+
+		/** 마지막으로 수집한 멤버 (주소 순으로 정렬, 중복 없음) */
+		TArray<TWeakObjectPtr<AActor>> Members;
+
+		/** 멤버십에 반영된 버블 딜레이 (바뀌면 다시 적용) */
+		float AppliedDilation = 1.0f;
+	};
+
+	struct FAffectedActor
+	{
+		/** 버블에 들어오기 전 CustomTimeDilation (나갈 때 복원) */
+		float BaseDilation = 1.0f;
+
+		/** 현재 적용한 버블 딜레이 (BaseDilation 에 곱해짐) */
+		float BubbleDilation = 1.0f;
+	};
+
+	/** 지난 틱에 발행한 오버랩 결과로 멤버를 갱신하고, 바뀐 버블이 있는지 반환 */
+	bool CollectOverlaps();
+
+	/** 버블 멤버를 합쳐 (겹치면 가장 느린 딜레이) 액터별 CustomTimeDilation 을 갱신 */
+	void ApplyMembership();
+
+	/** 다음 틱에 수집할 오버랩 발행 */
+	void IssueOverlaps();
+
+	void RestoreAll();
+
+	TArray<FBubble> Bubbles;
+
+	TMap<TWeakObjectPtr<AActor>, FAffectedActor> Affected;
+
+	/** 버블이 해제되어 다음 틱에 멤버십을 다시 계산해야 함 */
+	bool bMembershipDirty = false;
+};
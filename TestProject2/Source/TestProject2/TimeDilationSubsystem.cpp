@@ -0,0 +1,128 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TimeDilationSubsystem.h"
+#include "TestProject2.h"
+#include "Curves/CurveFloat.h"
+#include "Engine/World.h"
+#include "Kismet/GameplayStatics.h"
+
+void UTimeDilationSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	LoadedTransitionCurve = TransitionCurve.LoadSynchronous();
+}
+
+void UTimeDilationSubsystem::Deinitialize()
+{
+	Requests.Reset();
+	OnSlowMotionWeightChanged.Clear();
+
+	Super::Deinitialize();
+}
+
+void UTimeDilationSubsystem::RequestSlowMotion(UObject* Requester, float TargetDilation, int32 Priority)
+{
+	FSlowMotionRequest* Existing = Requests.FindByPredicate([Requester](const FSlowMotionRequest& Request) { return Request.Requester == Requester; });
+	if (Existing == nullptr)
+	{
+		Existing = &Requests.AddDefaulted_GetRef();
+		Existing->Requester = Requester;
+	}
+	Existing->TargetDilation = TargetDilation;
+	Existing->Priority = Priority;
+
+	UpdateActiveRequest();
+}
+
+void UTimeDilationSubsystem::ReleaseSlowMotion(UObject* Requester)
+{
+	Requests.RemoveAll([Requester](const FSlowMotionRequest& Request) { return Request.Requester == Requester; });
+
+	UpdateActiveRequest();
+}
+
+void UTimeDilationSubsystem::UpdateActiveRequest()
+{
+	Requests.RemoveAll([](const FSlowMotionRequest& Request) { return !Request.Requester.IsValid(); });
+
+	// 우선순위가 같으면 나중 요청이 이김
+	const FSlowMotionRequest* Best = nullptr;
+	for (const FSlowMotionRequest& Request : Requests)
+	{
+		if (Best == nullptr || Request.Priority >= Best->Priority)
+		{
+			Best = &Request;
+		}
+	}
+
+	if (Best)
+	{
+		const bool bDilationChanged = Best->TargetDilation != ActiveDilation;
+		ActiveDilation = Best->TargetDilation;
+		TargetProgress = 1.0f;
+
+		// 이미 전환이 끝난 상태 (Progress == TargetProgress) 에서 이기는 요청만 바뀌면 틱도 가중치 변화도 없으므로 바로 적용
+		if (bDilationChanged && Weight > 0.0f)
+		{
+			UGameplayStatics::SetGlobalTimeDilation(this, GetCurrentDilation());
+			OnSlowMotionWeightChanged.Broadcast(Weight);
+		}
+	}
+	else
+	{
+		TargetProgress = 0.0f;
+	}
+}
+
+float UTimeDilationSubsystem::GetCurrentDilation() const
+{
+	return FMath::Lerp(1.0f, ActiveDilation, Weight);
+}
+
+float UTimeDilationSubsystem::EvaluateWeight(float InProgress) const
+{
+	if (LoadedTransitionCurve)
+	{
+		return FMath::Clamp(LoadedTransitionCurve->GetFloatValue(InProgress), 0.0f, 1.0f);
+	}
+	return FMath::SmoothStep(0.0f, 1.0f, InProgress);
+}
+
+bool UTimeDilationSubsystem::IsTickable() const
+{
+	// 전환이 끝났으면 틱하지 않음
+	return Progress != TargetProgress;
+}
+
+void UTimeDilationSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	TP2_SCOPE_CYCLE_COUNTER(STAT_TP2_SlowMotionUpdate);
+	INC_DWORD_STAT(STAT_TP2_SlowMotionUpdates);
+
+	// 틱 DeltaTime 은 이미 딜레이된 값이므로 실제 시간을 사용
+	const float RealDeltaTime = GetWorld()->DeltaRealTimeSeconds;
+	const float Step = TransitionDuration > UE_KINDA_SMALL_NUMBER ? RealDeltaTime / TransitionDuration : 1.0f;
+	Progress = TargetProgress > Progress ? FMath::Min(Progress + Step, TargetProgress) : FMath::Max(Progress - Step, TargetProgress);
+
+	ApplyWeight(EvaluateWeight(Progress));
+}
+
+void UTimeDilationSubsystem::ApplyWeight(float NewWeight)
+{
+	if (NewWeight == Weight)
+	{
+		return;
+	}
+
+	Weight = NewWeight;
+	UGameplayStatics::SetGlobalTimeDilation(this, GetCurrentDilation());
+	OnSlowMotionWeightChanged.Broadcast(Weight);
+}
+
+TStatId UTimeDilationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UTimeDilationSubsystem, STATGROUP_Tickables);
+}
@@ -0,0 +1,92 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "TimeDilationSubsystem.generated.h"
+
+class UCurveFloat;
+
+/** 슬로우 모션 가중치 변경 알림 (0.0 = 정상 속도, 1.0 = 목표 슬로우 모션) */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnSlowMotionWeightChanged, float /*Weight*/);
+
+/**
+ * 월드의 글로벌 시간 딜레이를 관리합니다.
+ * 여러 액터가 우선순위와 함께 슬로우 모션을 요청할 수 있고, 가장 높은 우선순위 요청의 목표 딜레이로
+ * 커브 에셋을 따라 전환합니다. 전환은 딜레이되지 않은 실제 시간으로 프레임당 한 번 계산되며,
+ * 후처리 / 오디오 / VFX 등은 OnSlowMotionWeightChanged 의 가중치 하나만 구독합니다.
+ * 전환이 끝나면 틱하지 않습니다.
+ */
+UCLASS(config = Game)
+class TESTPROJECT2_API UTimeDilationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Requester 의 슬로우 모션 요청을 추가 / 갱신 */
+	UFUNCTION(BlueprintCallable, Category = "SlowMotion")
+	void RequestSlowMotion(UObject* Requester, float TargetDilation, int32 Priority = 0);
+
+	/** Requester 의 슬로우 모션 요청을 해제 */
+	UFUNCTION(BlueprintCallable, Category = "SlowMotion")
+	void ReleaseSlowMotion(UObject* Requester);
+
+	/** 현재 슬로우 모션 가중치 (0.0 ~ 1.0) */
+	UFUNCTION(BlueprintPure, Category = "SlowMotion")
+	float GetSlowMotionWeight() const { return Weight; }
+
+	/** 현재 적용 중인 글로벌 시간 딜레이 */
+	UFUNCTION(BlueprintPure, Category = "SlowMotion")
+	float GetCurrentDilation() const;
+
+	/** 가중치가 바뀐 프레임마다 한 번 호출됩니다. */
+	FOnSlowMotionWeightChanged OnSlowMotionWeightChanged;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+protected:
+	/** 전환 커브 (X: 0 ~ 1 정규화 시간, Y: 0 ~ 1 가중치). 없으면 SmoothStep 사용 */
+	UPROPERTY(config)
+	TSoftObjectPtr<UCurveFloat> TransitionCurve;
+
+	/** 정상 속도 <-> 슬로우 모션 전환 시간 (실제 시간, 초) */
+	UPROPERTY(config)
+	float TransitionDuration = 1.0f;
+
+private:
+	struct FSlowMotionRequest
+	{
+		TWeakObjectPtr<UObject> Requester;
+		float TargetDilation = 1.0f;
+		int32 Priority = 0;
+	};
+
+	/** 요청 목록이 바뀌면 목표 딜레이 / 진행 방향을 다시 계산 */
+	void UpdateActiveRequest();
+
+	/** 진행도에 커브를 적용한 가중치 */
+	float EvaluateWeight(float InProgress) const;
+
+	void ApplyWeight(float NewWeight);
+
+	TArray<FSlowMotionRequest> Requests;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UCurveFloat> LoadedTransitionCurve;
+
+	/** 현재 슬로우 모션 목표 딜레이 (요청이 모두 해제되어도 복귀가 끝날 때까지 유지) */
+	float ActiveDilation = 1.0f;
+
+	/** 전환 진행도 (0.0 = 정상, 1.0 = 슬로우 모션) 와 목표 진행도 */
+	float Progress = 0.0f;
+	float TargetProgress = 0.0f;
+
+	float Weight = 0.0f;
+};
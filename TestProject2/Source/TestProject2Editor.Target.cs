@@ -11,5 +11,6 @@ public class TestProject2EditorTarget : TargetRules
 		DefaultBuildSettings = BuildSettingsVersion.V5;
 		IncludeOrderVersion = EngineIncludeOrderVersion.Unreal5_5;
 		ExtraModuleNames.Add("TestProject2");
+		ExtraModuleNames.Add("TestProject2Editor");
 	}
 }
@@ -0,0 +1,225 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ExtractLedgesCommandlet.h"
+#include "ClimbableComponent.h"
+#include "ClimbableSubsystem.h"
+#include "LedgeDatabase.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+#include "UObject/Package.h"
+#include "WorldPartition/WorldPartition.h"
+#include "WorldPartition/WorldPartitionActorDescInstance.h"
+#include "WorldPartition/WorldPartitionHelpers.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogExtractLedges, Log, All);
+
+namespace ExtractLedges
+{
+	/** 윗면이 박스 모서리와 같은 LevelPrototyping 메쉬 (경사로 / 원기둥은 바운드 윗면이 실제 레지가 아님) */
+	static const TCHAR* BoxMeshes[] =
+	{
+		TEXT("/Game/LevelPrototyping/Meshes/SM_Cube.SM_Cube"),
+		TEXT("/Game/LevelPrototyping/Meshes/SM_ChamferCube.SM_ChamferCube"),
+	};
+
+	/** 위쪽에 아무것도 없는 레지의 여유 높이 */
+	static constexpr float MaxClearance = 10000.0f;
+
+	/** 여유 높이를 잴 레지 안쪽 거리 (캐릭터가 올라서는 지점) */
+	static constexpr float ClearanceInset = 30.0f;
+
+	struct FExtraction
+	{
+		TArray<FClimbableLedge> Ledges;
+		/** 여유 높이 계산용 정적 충돌 바운드 */
+		TArray<FBox> Obstacles;
+	};
+
+	static bool IsBoxMesh(const UStaticMeshComponent* MeshComponent)
+	{
+		const UStaticMesh* Mesh = MeshComponent->GetStaticMesh();
+		if (Mesh == nullptr)
+		{
+			return false;
+		}
+
+		const FString MeshPath = Mesh->GetPathName();
+		for (const TCHAR* BoxMesh : BoxMeshes)
+		{
+			if (MeshPath == BoxMesh)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	static void VisitActor(const AActor* Actor, FExtraction& Extraction)
+	{
+		static const FName ClimbableTag(TEXT("Climbable"));
+
+		const USceneComponent* Root = Actor->GetRootComponent();
+		if (Root == nullptr || Root->Mobility == EComponentMobility::Movable)
+		{
+			return;
+		}
+
+		const bool bTagged = Actor->Tags.Contains(ClimbableTag);
+		const bool bSelfRegistering = Actor->FindComponentByClass<UClimbableComponent>() != nullptr;
+
+		TInlineComponentArray<const UPrimitiveComponent*> Primitives(Actor);
+		for (const UPrimitiveComponent* Primitive : Primitives)
+		{
+			if (Primitive->Mobility == EComponentMobility::Movable || !Primitive->IsCollisionEnabled())
+			{
+				continue;
+			}
+
+			Extraction.Obstacles.Add(Primitive->Bounds.GetBox());
+
+			if (bSelfRegistering)
+			{
+				continue;
+			}
+
+			const UStaticMeshComponent* MeshComponent = Cast<UStaticMeshComponent>(Primitive);
+			if ((bTagged && Primitive == Root) || (MeshComponent && IsBoxMesh(MeshComponent)))
+			{
+				UClimbableSubsystem::BuildLedgesFromCollision(Primitive, Extraction.Ledges);
+			}
+		}
+	}
+
+	static float ComputeClearance(const FClimbableLedge& Ledge, TConstArrayView<FBox> Obstacles)
+	{
+		const FVector Probe = (Ledge.Start + Ledge.End) * 0.5f - Ledge.OutwardNormal * ClearanceInset;
+
+		float Clearance = MaxClearance;
+		for (const FBox& Obstacle : Obstacles)
+		{
+			if (Probe.X >= Obstacle.Min.X && Probe.X <= Obstacle.Max.X && Probe.Y >= Obstacle.Min.Y && Probe.Y <= Obstacle.Max.Y
+				&& Obstacle.Min.Z > Probe.Z + 1.0f)
+			{
+				Clearance = FMath::Min(Clearance, float(Obstacle.Min.Z - Probe.Z));
+			}
+		}
+		return Clearance;
+	}
+}
+
+UExtractLedgesCommandlet::UExtractLedgesCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UExtractLedgesCommandlet::Main(const FString& Params)
+{
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamValues;
+	ParseCommandLine(*Params, Tokens, Switches, ParamValues);
+
+	TArray<FString> Maps;
+	ParamValues.FindRef(TEXT("Map")).ParseIntoArray(Maps, TEXT(","));
+	if (Maps.Num() == 0)
+	{
+		UE_LOG(LogExtractLedges, Error, TEXT("Usage: -run=ExtractLedges -Map=/Game/Path/To/Map[,/Game/Other/Map] [-CellSize=500]"));
+		return 1;
+	}
+
+	const FString* CellSizeParam = ParamValues.Find(TEXT("CellSize"));
+	const float CellSize = CellSizeParam ? FCString::Atof(**CellSizeParam) : GetDefault<UClimbableSubsystem>()->GetCellSize();
+	if (CellSize <= 0.0f)
+	{
+		UE_LOG(LogExtractLedges, Error, TEXT("CellSize must be positive"));
+		return 1;
+	}
+
+	int32 NumFailed = 0;
+	for (const FString& Map : Maps)
+	{
+		NumFailed += ExtractMap(Map, CellSize) ? 0 : 1;
+	}
+	return NumFailed > 0 ? 1 : 0;
+}
+
+bool UExtractLedgesCommandlet::ExtractMap(const FString& MapPackageName, float CellSize)
+{
+	UPackage* Package = LoadPackage(nullptr, *MapPackageName, LOAD_None);
+	UWorld* World = Package ? UWorld::FindWorldInPackage(Package) : nullptr;
+	if (World == nullptr)
+	{
+		UE_LOG(LogExtractLedges, Error, TEXT("Failed to load map %s"), *MapPackageName);
+		return false;
+	}
+
+	World->WorldType = EWorldType::Editor;
+	World->AddToRoot();
+	if (!World->bIsWorldInitialized)
+	{
+		UWorld::InitializationValues IVS;
+		IVS.RequiresHitProxies(false);
+		IVS.ShouldSimulatePhysics(false);
+		IVS.EnableTraceCollision(false);
+		IVS.CreateNavigation(false);
+		IVS.CreateAISystem(false);
+		IVS.AllowAudioPlayback(false);
+		IVS.CreatePhysicsScene(true);
+		World->InitWorld(IVS);
+		World->PersistentLevel->UpdateModelComponents();
+		World->UpdateWorldComponents(true, false);
+	}
+
+	ExtractLedges::FExtraction Extraction;
+	if (UWorldPartition* WorldPartition = World->GetWorldPartition())
+	{
+		// One File Per Actor: 액터를 묶음 단위로 로드 / 언로드하며 순회 (전체를 한 번에 상주시키지 않음)
+		FWorldPartitionHelpers::ForEachActorWithLoading(WorldPartition, [&Extraction](const FWorldPartitionActorDescInstance* ActorDescInstance)
+		{
+			if (const AActor* Actor = ActorDescInstance->GetActor())
+			{
+				ExtractLedges::VisitActor(Actor, Extraction);
+			}
+			return true;
+		});
+	}
+	else
+	{
+		for (TActorIterator<AActor> It(World); It; ++It)
+		{
+			ExtractLedges::VisitActor(*It, Extraction);
+		}
+	}
+
+	TArray<float> Clearances;
+	Clearances.Reserve(Extraction.Ledges.Num());
+	for (const FClimbableLedge& Ledge : Extraction.Ledges)
+	{
+		Clearances.Add(ExtractLedges::ComputeClearance(Ledge, Extraction.Obstacles));
+	}
+
+	const FString Filename = FLedgeDatabase::GetFilenameForMap(MapPackageName);
+	IFileManager::Get().MakeDirectory(*FPaths::GetPath(Filename), true);
+	const bool bWritten = FLedgeDatabase::Write(Filename, Extraction.Ledges, Clearances, CellSize);
+
+	if (bWritten)
+	{
+		UE_LOG(LogExtractLedges, Display, TEXT("%s: %d ledges from %d static primitives -> %s (%lld bytes)"),
+			*MapPackageName, Extraction.Ledges.Num(), Extraction.Obstacles.Num(), *Filename, IFileManager::Get().FileSize(*Filename));
+	}
+	else
+	{
+		UE_LOG(LogExtractLedges, Error, TEXT("Failed to write %s"), *Filename);
+	}
+
+	World->DestroyWorld(false);
+	World->RemoveFromRoot();
+	return bWritten;
+}
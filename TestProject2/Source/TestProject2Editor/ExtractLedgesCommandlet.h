@@ -0,0 +1,29 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "ExtractLedgesCommandlet.generated.h"
+
+/**
+ * 맵의 정적 지오메트리 (태그 "Climbable" 액터, LevelPrototyping 박스 메쉬) 에서 레지 모서리, 윗면 높이, 여유 높이를 추출하여
+ * 맵별 바이너리 레지 데이터베이스 (FLedgeDatabase) 로 기록합니다. 쿠킹 전에 실행합니다.
+ *
+ *   UnrealEditor-Cmd TestProject2.uproject -run=ExtractLedges -Map=/Game/ThirdPerson/Maps/ThirdPersonMap [-CellSize=500]
+ *
+ * UClimbableComponent 를 가진 액터는 런타임 (또는 AGameplayCellData) 에서 직접 등록하므로 제외합니다.
+ */
+UCLASS()
+class UExtractLedgesCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UExtractLedgesCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	bool ExtractMap(const FString& MapPackageName, float CellSize);
+};
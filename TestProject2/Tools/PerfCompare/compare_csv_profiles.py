@@ -0,0 +1,306 @@
+#!/usr/bin/env python3
+# Copyright Epic Games, Inc. All Rights Reserved.
+"""
+두 CSV 프로파일러 캡처 (같은 입력 녹화를 재생한 ThirdPersonMap 실행) 를 정렬하여 비교하고,
+통계적으로 유의한 성능 회귀가 있으면 0 이 아닌 코드로 종료합니다. 표준 라이브러리만 사용합니다.
+
+캡처 (빌드마다 한 번씩, 같은 녹화 파일로):
+  UnrealEditor-Cmd TestProject2.uproject /Game/ThirdPerson/Maps/ThirdPersonMap -game -nullrhi -unattended \
+      -TP2ReplayInput=<녹화.tp2input> -csvCaptureFrames=100000
+  결과: Saved/Profiling/CSV/*.csv (재생이 끝나면 캡처를 닫고 종료)
+
+비교:
+  python3 compare_csv_profiles.py <기준.csv> <새.csv> [--config perf_thresholds.json] [--report result.json]
+
+정렬: 두 캡처 모두 TestProject2/ReplayStart 이벤트 프레임부터 ReplayEnd 이벤트 프레임까지 자른 뒤,
+  --skip-frames 만큼 앞을 버리고 짧은 쪽 길이에 맞춥니다. 이벤트가 없으면 캡처 처음 / 끝을 사용합니다.
+판정: 프레임 값은 자기 상관이 크므로 --block-frames 프레임씩 평균한 블록에 단측 Mann-Whitney U 검정을 하고,
+  p < alpha 이면서 중앙값 (statistic 이 mean 이면 평균) 변화가 상대 / 절대 임계값을 모두 넘으면 회귀로 봅니다.
+  임계값은 설정 파일의 defaults 와 지표 패턴 (fnmatch) 별 값으로 정하며, 명령줄 값이 defaults 를 덮어씁니다.
+
+종료 코드: 0 통과, 1 회귀 발견, 2 입력 오류
+"""
+
+import argparse
+import csv
+import fnmatch
+import json
+import math
+import os
+import statistics
+import sys
+
+DEFAULT_CONFIG = os.path.join(os.path.dirname(os.path.abspath(__file__)), "perf_thresholds.json")
+
+BUILTIN_DEFAULTS = {
+    "alpha": 0.01,
+    "max_regression_pct": 5.0,
+    "min_abs_change": 0.05,
+    "direction": "increase",
+}
+
+BUILTIN_COMPARE = ["FrameTime", "GameThreadTime", "TestProject2/*"]
+
+
+class CaptureError(Exception):
+    pass
+
+
+class Capture:
+    """CSV 프로파일러 파일 하나: 열 이름 -> 프레임별 값, 프레임별 이벤트"""
+
+    def __init__(self, path):
+        self.path = path
+        self.columns = {}
+        self.events = []
+        self._load()
+
+    def _load(self):
+        try:
+            with open(self.path, newline="", encoding="utf-8-sig") as f:
+                rows = list(csv.reader(f))
+        except OSError as e:
+            raise CaptureError(f"{self.path}: {e}")
+        if not rows:
+            raise CaptureError(f"{self.path}: empty file")
+
+        header = [name.strip() for name in rows[0]]
+        event_index = header.index("EVENTS") if "EVENTS" in header else None
+        values = {name: [] for i, name in enumerate(header) if name and i != event_index}
+
+        for row in rows[1:]:
+            # 끝의 메타데이터 행 ([HasHeaderRowAtEnd], [platform] ...) 과 반복된 헤더 행에서 멈춤
+            if not row or row[0].startswith("[") or row[0].strip() == header[0]:
+                break
+            for i, name in enumerate(header):
+                if i == event_index:
+                    continue
+                if not name:
+                    continue
+                cell = row[i].strip() if i < len(row) else ""
+                try:
+                    values[name].append(float(cell) if cell else 0.0)
+                except ValueError:
+                    values[name].append(0.0)
+            self.events.append(row[event_index] if event_index is not None and event_index < len(row) else "")
+
+        if not self.events:
+            raise CaptureError(f"{self.path}: no frames")
+        self.columns = values
+
+    def num_frames(self):
+        return len(self.events)
+
+    def find_event(self, name):
+        for frame, text in enumerate(self.events):
+            if any(event.strip().endswith(name) for event in text.split(";") if event.strip()):
+                return frame
+        return None
+
+    def replay_range(self, start_event, end_event):
+        start = self.find_event(start_event) if start_event else None
+        end = self.find_event(end_event) if end_event else None
+        return (start if start is not None else 0, end if end is not None else self.num_frames()), start is not None
+
+
+def percentile(sorted_values, pct):
+    if not sorted_values:
+        return 0.0
+    k = (len(sorted_values) - 1) * pct / 100.0
+    lo = math.floor(k)
+    hi = math.ceil(k)
+    return sorted_values[lo] + (sorted_values[hi] - sorted_values[lo]) * (k - lo)
+
+
+def block_means(values, block_frames):
+    if block_frames <= 1:
+        return list(values)
+    return [statistics.fmean(values[i:i + block_frames]) for i in range(0, len(values) - block_frames + 1, block_frames)]
+
+
+def mann_whitney_greater(a, b):
+    """H1: b 가 a 보다 큼. 정규 근사 + 동순위 보정, 단측 p 값"""
+    n1, n2 = len(a), len(b)
+    if n1 == 0 or n2 == 0:
+        return 1.0
+
+    combined = sorted([(v, 0) for v in a] + [(v, 1) for v in b])
+    ranks = [0.0] * len(combined)
+    tie_term = 0.0
+    i = 0
+    while i < len(combined):
+        j = i
+        while j + 1 < len(combined) and combined[j + 1][0] == combined[i][0]:
+            j += 1
+        rank = (i + j) / 2.0 + 1.0
+        for k in range(i, j + 1):
+            ranks[k] = rank
+        t = j - i + 1
+        tie_term += t * t * t - t
+        i = j + 1
+
+    rank_sum_b = sum(rank for rank, (_, group) in zip(ranks, combined) if group == 1)
+    u_b = rank_sum_b - n2 * (n2 + 1) / 2.0
+    n = n1 + n2
+    mean_u = n1 * n2 / 2.0
+    var_u = n1 * n2 / 12.0 * ((n + 1) - tie_term / (n * (n - 1))) if n > 1 else 0.0
+    if var_u <= 0.0:
+        return 1.0
+    z = (u_b - mean_u - 0.5) / math.sqrt(var_u)
+    return 0.5 * math.erfc(z / math.sqrt(2.0))
+
+
+def load_config(path):
+    config = {"defaults": dict(BUILTIN_DEFAULTS), "metrics": {}, "compare": list(BUILTIN_COMPARE)}
+    if path is None:
+        return config
+    try:
+        with open(path, encoding="utf-8") as f:
+            loaded = json.load(f)
+    except (OSError, ValueError) as e:
+        raise CaptureError(f"{path}: {e}")
+    config["defaults"].update(loaded.get("defaults", {}))
+    config["metrics"] = loaded.get("metrics", {})
+    config["compare"] = loaded.get("compare", config["compare"])
+    return config
+
+
+def thresholds_for(metric, config):
+    result = dict(config["defaults"])
+    # 패턴이 구체적일수록 (와일드카드가 적을수록) 나중에 적용
+    for pattern in sorted(config["metrics"], key=lambda p: (p.count("*") == 0, len(p))):
+        if fnmatch.fnmatchcase(metric, pattern):
+            result.update(config["metrics"][pattern])
+    return result
+
+
+def compare_metric(metric, base_values, new_values, limits, block_frames):
+    base_sorted = sorted(base_values)
+    new_sorted = sorted(new_values)
+    # 타이밍은 중앙값, 드문드문 기록되는 카운터 (발사 / 조회 수) 는 평균으로 비교
+    if limits.get("statistic", "median") == "mean":
+        base_center, new_center = statistics.fmean(base_values), statistics.fmean(new_values)
+    else:
+        base_center, new_center = percentile(base_sorted, 50.0), percentile(new_sorted, 50.0)
+    abs_change = new_center - base_center
+    rel_change = abs_change / base_center * 100.0 if base_center > 0.0 else (0.0 if abs_change == 0.0 else math.inf)
+
+    base_blocks = block_means(base_values, block_frames)
+    new_blocks = block_means(new_values, block_frames)
+    direction = limits["direction"]
+    p_increase = mann_whitney_greater(base_blocks, new_blocks)
+    p_decrease = mann_whitney_greater(new_blocks, base_blocks)
+    if direction == "increase":
+        p_value, signed_abs, signed_rel = p_increase, abs_change, rel_change
+    elif direction == "decrease":
+        p_value, signed_abs, signed_rel = p_decrease, -abs_change, -rel_change
+    else:
+        p_value, signed_abs, signed_rel = min(1.0, 2.0 * min(p_increase, p_decrease)), abs(abs_change), abs(rel_change)
+
+    regressed = (p_value < limits["alpha"]
+                 and signed_rel >= limits["max_regression_pct"]
+                 and signed_abs >= limits["min_abs_change"])
+
+    return {
+        "metric": metric,
+        "statistic": limits.get("statistic", "median"),
+        "base": base_center,
+        "new": new_center,
+        "base_p95": percentile(base_sorted, 95.0),
+        "new_p95": percentile(new_sorted, 95.0),
+        "abs_change": abs_change,
+        "rel_change_pct": rel_change,
+        "p_value": p_value,
+        "blocks": min(len(base_blocks), len(new_blocks)),
+        "thresholds": limits,
+        "regressed": regressed,
+    }
+
+
+def select_metrics(base, new, patterns):
+    common = [name for name in base.columns if name in new.columns]
+    return [name for name in common if any(fnmatch.fnmatchcase(name, pattern) for pattern in patterns)]
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description="Compare two CSV profiler captures of the same scripted ThirdPersonMap run.")
+    parser.add_argument("base", help="baseline capture (.csv)")
+    parser.add_argument("new", help="capture to check (.csv)")
+    parser.add_argument("--config", default=DEFAULT_CONFIG if os.path.exists(DEFAULT_CONFIG) else None,
+                        help="threshold config (JSON, default: perf_thresholds.json next to this script)")
+    parser.add_argument("--metric", action="append", default=None,
+                        help="metric pattern to compare (fnmatch, repeatable; default: config 'compare' list)")
+    parser.add_argument("--alpha", type=float, help="significance level")
+    parser.add_argument("--threshold-pct", type=float, help="minimum relative median change to flag (%%)")
+    parser.add_argument("--min-abs", type=float, help="minimum absolute median change to flag (ms or count)")
+    parser.add_argument("--skip-frames", type=int, default=None, help="frames to drop after ReplayStart")
+    parser.add_argument("--block-frames", type=int, default=None, help="frames averaged per test sample")
+    parser.add_argument("--start-event", default="ReplayStart")
+    parser.add_argument("--end-event", default="ReplayEnd")
+    parser.add_argument("--report", help="write the full result as JSON")
+    args = parser.parse_args(argv)
+
+    try:
+        config = load_config(args.config)
+        base = Capture(args.base)
+        new = Capture(args.new)
+    except CaptureError as e:
+        print(f"error: {e}", file=sys.stderr)
+        return 2
+
+    for key, value in (("alpha", args.alpha), ("max_regression_pct", args.threshold_pct), ("min_abs_change", args.min_abs)):
+        if value is not None:
+            config["defaults"][key] = value
+    skip_frames = args.skip_frames if args.skip_frames is not None else int(config["defaults"].get("skip_frames", 60))
+    block_frames = args.block_frames if args.block_frames is not None else int(config["defaults"].get("block_frames", 30))
+
+    (base_start, base_end), base_has_event = base.replay_range(args.start_event, args.end_event)
+    (new_start, new_end), new_has_event = new.replay_range(args.start_event, args.end_event)
+    if not (base_has_event and new_has_event):
+        print(f"warning: '{args.start_event}' event missing, aligning from the first captured frame", file=sys.stderr)
+    base_start += skip_frames
+    new_start += skip_frames
+    length = min(base_end - base_start, new_end - new_start)
+    if length < 2 * max(block_frames, 1):
+        print(f"error: only {max(length, 0)} aligned frames after skipping {skip_frames}", file=sys.stderr)
+        return 2
+    if abs((base_end - base_start) - (new_end - new_start)) > 0.01 * length:
+        print(f"warning: replay lengths differ ({base_end - base_start} vs {new_end - new_start} frames); "
+              "the runs may not be from the same recording", file=sys.stderr)
+
+    patterns = args.metric or config["compare"]
+    metrics = select_metrics(base, new, patterns)
+    if not metrics:
+        print(f"error: no metric matching {patterns} is present in both captures", file=sys.stderr)
+        return 2
+
+    results = []
+    for metric in metrics:
+        base_values = base.columns[metric][base_start:base_start + length]
+        new_values = new.columns[metric][new_start:new_start + length]
+        results.append(compare_metric(metric, base_values, new_values, thresholds_for(metric, config), block_frames))
+
+    name_width = max(len(r["metric"]) for r in results)
+    print(f"{length} aligned frames ({block_frames}-frame blocks), base {args.base}, new {args.new}")
+    print(f"{'metric':<{name_width}}  {'base':>9}  {'new':>9}  {'change':>8}  {'base p95':>9}  {'new p95':>9}  {'p':>8}")
+    for r in results:
+        change = f"{r['rel_change_pct']:+.1f}%" if math.isfinite(r["rel_change_pct"]) else "new"
+        flag = "  REGRESSION" if r["regressed"] else ""
+        print(f"{r['metric']:<{name_width}}  {r['base']:9.3f}  {r['new']:9.3f}  {change:>8}  "
+              f"{r['base_p95']:9.3f}  {r['new_p95']:9.3f}  {r['p_value']:8.2g}{flag}")
+
+    regressions = [r for r in results if r["regressed"]]
+    if args.report:
+        with open(args.report, "w", encoding="utf-8") as f:
+            json.dump({"frames": length, "block_frames": block_frames, "results": results,
+                       "regressions": [r["metric"] for r in regressions]}, f, indent=2)
+
+    if regressions:
+        print(f"FAILED: {len(regressions)} regression(s): {', '.join(r['metric'] for r in regressions)}")
+        return 1
+    print("PASSED")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())